@@ -10,7 +10,7 @@ if %errorlevel% neq 0 (
 )
 
 :: Компилируем все исходные файлы
-gcc -Wall -Wextra -std=c99 -Iinclude src/encod_func.c src/decod_func.c src/tables.c src/main.c -o main
+gcc -Wall -Wextra -std=c99 -O2 -pthread -Iinclude src/encod_func.c src/decod_func.c src/tables.c src/cpu_features.c src/radix.c src/bignum.c src/file_io.c src/parallel.c src/main.c -o main
 
 if %errorlevel% neq 0 (
     echo Ошибка компиляции
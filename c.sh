@@ -11,7 +11,7 @@ fi
 mkdir -p output
 
 # Компилируем проект
-gcc -Wall -Wextra -std=c99 -Iinclude src/encod_func.c src/decod_func.c src/tables.c src/main.c -o output/main
+gcc -Wall -Wextra -std=c99 -O2 -pthread -Iinclude src/encod_func.c src/decod_func.c src/tables.c src/cpu_features.c src/radix.c src/bignum.c src/file_io.c src/parallel.c src/main.c -o output/main
 
 if [ $? -ne 0 ]; then
     echo "Ошибка компиляции"
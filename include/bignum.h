@@ -0,0 +1,25 @@
+#ifndef BIGNUM_H
+#define BIGNUM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "parallel.h"
+
+// Основание 2^32 (двоичные слова) обозначается нулём
+#define BIGNUM_BINARY 0u
+
+// Функция умножения r = a * b в словах по основанию base (r - na + nb слов)
+int bignum_mul(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t base);
+
+// Функция умножения r = a * b на пуле потоков (NULL - в вызывающем потоке)
+int bignum_mul_parallel(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t base,
+                        thread_pool* pool);
+
+// Функция прибавления b к a (в a должно быть место для max(na, nb) + 1 слов)
+size_t bignum_add(uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t base);
+
+// Функция отбрасывания старших нулевых слов
+size_t bignum_normalize(const uint32_t* a, size_t n);
+
+#endif // BIGNUM_H
\ No newline at end of file
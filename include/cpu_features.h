@@ -0,0 +1,34 @@
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+// Векторные ядра x86 собираются только компиляторами с поддержкой target-атрибутов
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CPU_X86 1
+#endif
+
+// Ядра NEON собираются для AArch64, где NEON есть всегда
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define CPU_ARM64 1
+#endif
+
+// Флаги возможностей процессора
+#define CPU_SSE2       (1u << 0)
+#define CPU_SSSE3      (1u << 1)
+#define CPU_AVX2       (1u << 2)
+#define CPU_AVX512BW   (1u << 3)
+#define CPU_AVX512VBMI (1u << 4)
+#define CPU_NEON       (1u << 5)
+
+// Переменная окружения для принудительного выбора уровня (scalar, sse2, ssse3, avx2, avx512, neon)
+#define CPU_TIER_ENV "BASE_CPU"
+
+// Функция определения возможностей процессора (результат кэшируется)
+unsigned int cpu_features(void);
+
+// Функция ограничения используемых расширений заданным уровнем (0 - успех, -1 - неизвестный уровень)
+int cpu_features_limit(const char* tier);
+
+// Функция получения названия наивысшего используемого уровня
+const char* cpu_tier_name(void);
+
+#endif // CPU_FEATURES_H
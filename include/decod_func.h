@@ -2,6 +2,14 @@
 #define DECODING_H
 
 #include <stdio.h>
+#include <stdint.h>
+
+#include "parallel.h"
+
+// Признак ошибки функций *_into: буфер мал или вход некорректен
+#ifndef BASE_ERROR
+#define BASE_ERROR ((size_t)-1)
+#endif
 
 // Функция кодирования исходного файла base16 - алгоритмом 
 unsigned char* base16_decode(const unsigned char* input, size_t len, unsigned char* output);
@@ -15,10 +23,102 @@ unsigned char* base58_decode(const unsigned char* input, size_t len, size_t* out
 // Функция кодирования исходного файла base62 - алгоритмом 
 unsigned char* base62_decode(const unsigned char* input, size_t len, size_t* output_len);
 
+// Функция блочного декодирования исходного файла base58 - алгоритмом (блоки по 32 байта)
+unsigned char* base58_decode_blocked(const unsigned char* input, size_t len, size_t* output_len);
+
+// Функция блочного декодирования исходного файла base62 - алгоритмом (блоки по 32 байта)
+unsigned char* base62_decode_blocked(const unsigned char* input, size_t len, size_t* output_len);
+
 // Функция кодирования исходного файла base64 - алгоритмом
 unsigned char* base64_decode(const unsigned char* input, size_t len, size_t* output_len);
 
 // Функция кодирования исходного файла base85 - алгоритмом 
 unsigned char* base85_decode(const unsigned char* input, size_t len, size_t* output_len);
 
-#endif
\ No newline at end of file
+// Функция декодирования исходного файла ascii85 - алгоритмом (Adobe: 'z'/'y', неполные группы, <~ ~>)
+unsigned char* ascii85_decode(const unsigned char* input, size_t len, size_t* output_len);
+
+// Наибольшая длина результата декодирования len символов в байтах
+size_t base16_decoded_max_len(size_t len);
+size_t base32_decoded_max_len(size_t len);
+size_t base58_decoded_max_len(size_t len);
+size_t base62_decoded_max_len(size_t len);
+size_t base58_blocked_decoded_max_len(size_t len);
+size_t base62_blocked_decoded_max_len(size_t len);
+size_t base64_decoded_max_len(size_t len);
+size_t base85_decoded_max_len(size_t len);
+size_t ascii85_decoded_max_len(size_t len);
+
+// Декодирование в буфер вызывающего (cap байт): возвращает число записанных байтов
+// или BASE_ERROR; память не выделяется
+size_t base16_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base32_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base58_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base62_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base58_decode_blocked_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base62_decode_blocked_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base64_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base85_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t ascii85_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+
+// Запас буфера потокового декодирования сверх baseN_decoded_max_len(len): квант,
+// собранный из символов прошлых вызовов update
+#ifndef BASE_STREAM_SLACK
+#define BASE_STREAM_SLACK 8
+#endif
+
+// Состояние потокового декодирования: неполный квант (без пробельных символов) между
+// вызовами update и позиция в потоке
+typedef struct {
+    unsigned char carry[8];
+    uint64_t carry_pos[8];  // абсолютные позиции символов неполного кванта
+    size_t carry_len;
+    uint64_t offset;        // количество уже принятых символов потока
+    uint64_t error_offset;  // позиция первого недопустимого символа (после BASE_ERROR)
+    int failed;
+} base_dec_state;
+
+// Потоковое декодирование: init, затем update на каждый фрагмент (границы фрагментов любые,
+// пробелы и переводы строк пропускаются) и final в конце. update/final пишут в буфер
+// вызывающего (cap не меньше baseN_decoded_max_len(len) + BASE_STREAM_SLACK) и возвращают
+// число записанных байтов или BASE_ERROR; при ошибке входа state.error_offset указывает
+// на первый недопустимый символ
+void base16_dec_init(base_dec_state* state);
+size_t base16_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base16_dec_final(base_dec_state* state, unsigned char* output, size_t cap);
+
+void base32_dec_init(base_dec_state* state);
+size_t base32_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base32_dec_final(base_dec_state* state, unsigned char* output, size_t cap);
+
+void base64_dec_init(base_dec_state* state);
+size_t base64_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base64_dec_final(base_dec_state* state, unsigned char* output, size_t cap);
+
+void base85_dec_init(base_dec_state* state);
+size_t base85_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+size_t base85_dec_final(base_dec_state* state, unsigned char* output, size_t cap);
+
+// Параллельное декодирование на пуле потоков (NULL - в вызывающем потоке): вход делится
+// на части по границам групп, части декодируются сразу на свои места в выходе. Результат
+// тот же, что у baseN_decode_into; при ошибке входа *error_offset (если не NULL) - позиция
+// первого недопустимого символа, из ошибок нескольких частей выбирается самая ранняя
+size_t base16_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset);
+size_t base32_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset);
+size_t base64_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset);
+size_t base85_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset);
+
+// Base58/Base62 на пуле потоков: вход не делится, параллельно идёт перевод большого числа
+size_t base58_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset);
+size_t base62_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset);
+
+// Функция выбора векторных ядер декодирования до запуска потоков
+void decode_kernels_init(void);
+
+#endif
@@ -3,6 +3,13 @@
 
 #include <stdio.h>
 
+#include "parallel.h"
+
+// Признак ошибки функций *_into: буфер мал или вход некорректен
+#ifndef BASE_ERROR
+#define BASE_ERROR ((size_t)-1)
+#endif
+
 // Функция кодирования исходного файла base16 - алгоритмом --- РАБОТАЕТ
 char* base16_encode(const unsigned char *input, size_t input_len, char *output);
 // Функция кодирования исходного файла base32 - алгоритмом --- РАБОТАЕТ
@@ -14,10 +21,93 @@ char* base58_encode(const unsigned char* input, size_t len, char* output);
 // Функция кодирования исходного файла base62 - алгоритмом --- РАБОТАЕТ
 char* base62_encode(const unsigned char* input, size_t len, char* output);
 
+// Функция блочного кодирования исходного файла base58 - алгоритмом (блоки по 32 байта)
+char* base58_encode_blocked(const unsigned char* input, size_t len, char* output);
+
+// Функция блочного кодирования исходного файла base62 - алгоритмом (блоки по 32 байта)
+char* base62_encode_blocked(const unsigned char* input, size_t len, char* output);
+
 // Функция кодирования исходного файла base64 - алгоритмом --- РАБОТАЕТ
 char* base64_encode(const unsigned char* input, size_t len);
 
 // Функция кодирования исходного файла base85 - алгоритмом --- РАБОТАЕТ
 char* base85_encode(const unsigned char* input, size_t len);
 
+// Флаги Ascii85
+#define ASCII85_FRAME  0x1  // обрамление "<~" ... "~>"
+#define ASCII85_SPACES 0x2  // 'y' для группы из четырёх пробелов
+#define ASCII85_RUNS   0x4  // 'z' для нулевой группы (всегда включено в ascii85_encode)
+
+// Функция кодирования исходного файла ascii85 - алгоритмом (Adobe: 'z', неполные группы, <~ ~>)
+char* ascii85_encode(const unsigned char* input, size_t len, int options);
+
+// Длина результата кодирования в символах (без завершающего нуля)
+size_t base16_encoded_len(size_t len);
+size_t base32_encoded_len(size_t len);
+size_t base58_encoded_len(size_t len);          // верхняя оценка
+size_t base62_encoded_len(size_t len);          // верхняя оценка
+size_t base58_blocked_encoded_len(size_t len);
+size_t base62_blocked_encoded_len(size_t len);
+size_t base64_encoded_len(size_t len);
+size_t base85_encoded_len(size_t len);
+size_t ascii85_encoded_len(size_t len, int options); // верхняя оценка
+
+// Кодирование в буфер вызывающего (cap байт, без завершающего нуля): возвращает число
+// записанных символов или BASE_ERROR; память не выделяется
+size_t base16_encode_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base32_encode_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base58_encode_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base62_encode_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base58_encode_blocked_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base62_encode_blocked_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base64_encode_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base85_encode_into(const unsigned char* input, size_t len, char* output, size_t cap);
+size_t ascii85_encode_into(const unsigned char* input, size_t len, int options, char* output, size_t cap);
+
+// Запас буфера потокового кодирования сверх baseN_encoded_len(len): неполная группа
+// из прошлых вызовов update и хвост, который пишет final
+#ifndef BASE_STREAM_SLACK
+#define BASE_STREAM_SLACK 8
+#endif
+
+// Состояние потокового кодирования: неполная группа (до 4 байт) между вызовами update
+typedef struct {
+    unsigned char carry[4];
+    size_t carry_len;
+} base_enc_state;
+
+// Потоковое кодирование: init, затем update на каждый фрагмент входа и final в конце.
+// update/final пишут в буфер вызывающего (cap не меньше baseN_encoded_len(len) + BASE_STREAM_SLACK)
+// и возвращают число записанных символов или BASE_ERROR
+void base16_enc_init(base_enc_state* state);
+size_t base16_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base16_enc_final(base_enc_state* state, char* output, size_t cap);
+
+void base32_enc_init(base_enc_state* state);
+size_t base32_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base32_enc_final(base_enc_state* state, char* output, size_t cap);
+
+void base64_enc_init(base_enc_state* state);
+size_t base64_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base64_enc_final(base_enc_state* state, char* output, size_t cap);
+
+void base85_enc_init(base_enc_state* state);
+size_t base85_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap);
+size_t base85_enc_final(base_enc_state* state, char* output, size_t cap);
+
+// Параллельное кодирование на пуле потоков (NULL - в вызывающем потоке): вход делится по
+// границам групп, части пишутся в непересекающиеся участки output по точным смещениям.
+// Результат совпадает с baseN_encode_into (cap не меньше baseN_encoded_len(len))
+size_t base16_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool);
+size_t base32_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool);
+size_t base64_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool);
+size_t base85_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool);
+
+// Base58/Base62 на пуле потоков: вход не делится, параллельно идёт перевод большого числа
+size_t base58_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool);
+size_t base62_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool);
+
+// Функция выбора векторных ядер кодирования до запуска потоков
+void encode_kernels_init(void);
+
 #endif
\ No newline at end of file
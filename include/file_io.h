@@ -0,0 +1,51 @@
+#ifndef FILE_IO_H
+#define FILE_IO_H
+
+#include <stddef.h>
+
+// Размер, начиная с которого отображению даётся подсказка об огромных страницах
+#define FILE_HUGEPAGE_SIZE (2u << 20)
+
+// Наибольший размер, для которого страницы отображения подгружаются сразу (MAP_POPULATE)
+#define FILE_POPULATE_LIMIT ((size_t)256 << 20)
+
+// Содержимое входного файла только для чтения: отображение в память или прочитанный буфер
+typedef struct {
+    const unsigned char* data;  // данные файла (не NULL, даже для пустого файла)
+    size_t size;                // размер данных в байтах
+    int mapped;                 // 1 - отображение mmap, 0 - буфер malloc
+} file_view;
+
+// Функция открытия файла для чтения без копирования ("-" - стандартный ввод; 0 - успех, -1 - ошибка)
+int file_view_open(const char* path, file_view* view);
+
+// Функция освобождения данных файла
+void file_view_close(file_view* view);
+
+// Входной файл пакетного режима
+typedef struct {
+    char* path;
+    size_t size;  // размер в байтах (0, если файл недоступен)
+} file_entry;
+
+// Список входных файлов пакетного режима
+typedef struct {
+    file_entry* entries;
+    size_t count;
+    size_t capacity;
+    size_t skipped;  // пути списка, не попавшие в него (недоступные или слишком длинные)
+} file_list;
+
+// Функция проверки, является ли путь каталогом (1 - да, 0 - нет)
+int file_is_directory(const char* path);
+
+// Функция создания каталога, если его нет (0 - каталог есть или создан, -1 - ошибка)
+int file_make_directory(const char* path);
+
+// Функция сбора файлов: обычные файлы каталога или пути из файла-списка (0 - успех, -1 - ошибка)
+int file_list_open(const char* path, file_list* list);
+
+// Функция освобождения списка файлов
+void file_list_close(file_list* list);
+
+#endif // FILE_IO_H
@@ -0,0 +1,34 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stddef.h>
+
+// Наибольшее число потоков пула
+#define PARALLEL_MAX_THREADS 256
+
+// Наименьший объём работы одной задачи параллельного кодека: меньшие входы не делятся
+#define PARALLEL_MIN_CHUNK ((size_t)256 << 10)
+
+// Пул потоков: рабочие потоки создаются один раз и ждут очередную пачку задач
+typedef struct thread_pool thread_pool;
+
+// Задача пачки: index - номер задачи от 0 до count - 1
+typedef void (*parallel_task)(void* ctx, size_t index);
+
+// Функция количества доступных процессоров (не меньше 1)
+int parallel_cpu_count(void);
+
+// Функция создания пула из threads потоков (вместе с вызывающим); NULL - ошибка
+thread_pool* thread_pool_create(int threads);
+
+// Функция числа потоков пула (1 для NULL)
+int thread_pool_size(const thread_pool* pool);
+
+// Функция выполнения count задач на пуле (возвращает управление, когда выполнены все);
+// с пулом NULL задачи выполняются по очереди в вызывающем потоке
+void thread_pool_run(thread_pool* pool, size_t count, parallel_task task, void* ctx);
+
+// Функция остановки потоков и освобождения пула
+void thread_pool_destroy(thread_pool* pool);
+
+#endif // PARALLEL_H
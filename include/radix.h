@@ -0,0 +1,59 @@
+#ifndef RADIX_H
+#define RADIX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "parallel.h"
+
+// Основания машинных слов: наибольшие степени 58 и 62, помещающиеся в 32 бита
+#define BASE58_LIMB       656356768u   // 58^5
+#define BASE62_LIMB       916132832u   // 62^5
+#define RADIX_LIMB_DIGITS 5            // цифр в одном слове
+
+// Размер блока в блочном режиме Base58/Base62: 32 байта - 44 цифры Base58 или 43 цифры Base62
+#define RADIX_BLOCK_BYTES 32
+
+// Признак ошибки выделения памяти при переводе
+#define RADIX_ERROR ((size_t)-1)
+
+// Слов в буфере на стеке у кодеков: короткие входы (до ~3.6 КБ байтов или ~5.3 КБ символов)
+// переводятся без обращения к куче
+#define RADIX_STACK_LIMBS 1024
+
+// Функция перевода байтов (big-endian число) в слова по основанию limb_base
+size_t radix_from_bytes(const unsigned char* input, size_t len, uint32_t* limbs, uint32_t limb_base);
+
+// Функция перевода байтов в слова на пуле потоков (NULL - в вызывающем потоке)
+size_t radix_from_bytes_parallel(const unsigned char* input, size_t len, uint32_t* limbs, uint32_t limb_base,
+                                 thread_pool* pool);
+
+// Функция выписывания слов по основанию radix^5 в символы алфавита (без ведущих нулей)
+size_t radix_limbs_to_chars(const uint32_t* limbs, size_t count, uint32_t radix, const char* table, char* output);
+
+// Функция количества символов, которое выпишет radix_limbs_to_chars
+size_t radix_limbs_chars_len(const uint32_t* limbs, size_t count, uint32_t radix);
+
+// Функция перевода символов алфавита (по основанию radix) в 32-битные слова
+size_t radix_from_chars(const unsigned char* input, size_t len, const unsigned char* rev_table, uint32_t radix, uint32_t* limbs);
+
+// Функция перевода символов алфавита в 32-битные слова на пуле потоков (NULL - в вызывающем потоке)
+size_t radix_from_chars_parallel(const unsigned char* input, size_t len, const unsigned char* rev_table, uint32_t radix,
+                                 uint32_t* limbs, thread_pool* pool);
+
+// Функция выписывания 32-битных слов в байты (big-endian, без ведущих нулей)
+size_t radix_limbs_to_bytes(const uint32_t* limbs, size_t count, unsigned char* output);
+
+// Функция количества байтов, которое выпишет radix_limbs_to_bytes
+size_t radix_limbs_bytes_len(const uint32_t* limbs, size_t count);
+
+// Функция ширины группы цифр для блока из len байтов
+size_t radix_block_width(size_t len, uint32_t radix);
+
+// Функция перевода блока байтов в группу цифр фиксированной ширины
+void radix_block_to_chars(const unsigned char* block, size_t len, uint32_t radix, const char* table, char* output, size_t width);
+
+// Функция перевода группы цифр фиксированной ширины в блок байтов
+int radix_block_from_chars(const unsigned char* input, size_t width, const unsigned char* rev_table, uint32_t radix, unsigned char* output, size_t len);
+
+#endif // RADIX_H
\ No newline at end of file
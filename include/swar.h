@@ -0,0 +1,59 @@
+#ifndef SWAR_H
+#define SWAR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Байт 0x01 / 0x80 в каждой позиции 64-битного слова
+#define SWAR_ONES 0x0101010101010101ULL
+#define SWAR_HIGH 0x8080808080808080ULL
+
+// Функция перестановки байтов 64-битного слова в обратном порядке
+static inline uint64_t swar_bswap64(uint64_t x) {
+#ifdef __GNUC__
+    return __builtin_bswap64(x);
+#else
+    x = ((x & 0x00FF00FF00FF00FFULL) << 8) | ((x >> 8) & 0x00FF00FF00FF00FFULL);
+    x = ((x & 0x0000FFFF0000FFFFULL) << 16) | ((x >> 16) & 0x0000FFFF0000FFFFULL);
+    return (x << 32) | (x >> 32);
+#endif
+}
+
+// Функция чтения 8 байт как числа со старшим байтом первым (big-endian)
+static inline uint64_t swar_load_be64(const unsigned char* p) {
+    uint64_t x;
+    memcpy(&x, p, sizeof(x));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    return x;
+#else
+    return swar_bswap64(x);
+#endif
+}
+
+// Функция записи 8 байт числа со старшим байтом первым (big-endian)
+static inline void swar_store_be64(unsigned char* p, uint64_t x) {
+#if !(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    x = swar_bswap64(x);
+#endif
+    memcpy(p, &x, sizeof(x));
+}
+
+// Функция записи младших n байт числа (1 <= n <= 8) со старшим байтом первым
+static inline void swar_store_be(unsigned char* p, uint64_t x, size_t n) {
+    unsigned char bytes[8];
+    swar_store_be64(bytes, x << (64 - 8 * n));
+    memcpy(p, bytes, n);
+}
+
+// Функция побайтового сравнения x >= n (байты x меньше 0x80): 0x80 в байтах, где условие верно
+static inline uint64_t swar_ge(uint64_t x, unsigned char n) {
+    return (x + (0x80 - n) * SWAR_ONES) & SWAR_HIGH;
+}
+
+// Функция побайтового сравнения x <= n (байты x меньше 0x80): 0x80 в байтах, где условие верно
+static inline uint64_t swar_le(uint64_t x, unsigned char n) {
+    return ((0x80 + n) * SWAR_ONES - x) & SWAR_HIGH;
+}
+
+#endif // SWAR_H
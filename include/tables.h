@@ -1,6 +1,9 @@
 #ifndef TABLES_H
 #define TABLES_H
 
+// Значение в обратной таблице для символа, не входящего в алфавит
+#define BASE_INVALID 0xFF
+
 extern const char base16_table[];
 extern const char base32_table[];
 extern const char base58_table[];
@@ -8,4 +11,11 @@ extern const char base62_table[];
 extern const char base64_table[];
 extern const char base85_table[];
 
+extern const unsigned char base16_rev_table[256];
+extern const unsigned char base32_rev_table[256];
+extern const unsigned char base58_rev_table[256];
+extern const unsigned char base62_rev_table[256];
+extern const unsigned char base64_rev_table[256];
+extern const unsigned char base85_rev_table[256];
+
 #endif // TABLES_H
\ No newline at end of file
@@ -0,0 +1,640 @@
+/**
+ * @file bignum.c
+ * @brief Умножение больших чисел для перевода между системами счисления (Base58, Base62)
+ *
+ * @note Числа хранятся массивами 32-битных слов (младшее слово первое) по основанию
+ *       2^32 либо radix^5. Небольшие числа умножаются в столбик, большие - через
+ *       теоретико-числовое преобразование Фурье (NTT) по трём простым модулям с
+ *       восстановлением коэффициентов китайской теоремой об остатках.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/bignum.h"
+#include "../include/radix.h"
+#include "../include/parallel.h"
+
+// Меньший из множителей, начиная с которого умножение выполняется через NTT
+#define NTT_THRESHOLD 48
+
+// Длина преобразования, начиная с которой NTT выполняется на пуле потоков
+#define NTT_PARALLEL_MIN_LEN ((size_t)1 << 15)
+
+// Бабочек одного этапа преобразования на задачу пула
+#define NTT_PARALLEL_CHUNK ((size_t)1 << 13)
+
+// Наибольшая длина преобразования (ограничена модулем 754974721 = 45 * 2^24 + 1)
+#define NTT_MAX_LEN ((size_t)1 << 24)
+
+
+// Простой модуль NTT с константами для умножения Монтгомери (R = 2^32)
+typedef struct {
+    uint32_t p;     // модуль
+    uint32_t pinv;  // -p^(-1) mod 2^32
+    uint32_t r2;    // 2^64 mod p
+    uint32_t g;     // первообразный корень
+} ntt_prime;
+
+// Произведение модулей ~2^89.2 покрывает коэффициенты свёртки n * (2^32)^2 при n <= 2^24
+#define NTT_P1 2013265921u  // 15 * 2^27 + 1
+#define NTT_P2 469762049u   // 7 * 2^26 + 1
+#define NTT_P3 754974721u   // 45 * 2^24 + 1
+
+static const ntt_prime ntt_primes[3] = {
+    {NTT_P1, 0x77FFFFFFu, 1172168163u, 31},
+    {NTT_P2, 0x1BFFFFFFu, 460175152u, 3},
+    {NTT_P3, 0x2CFFFFFFu, 749009521u, 11},
+};
+
+// Константы алгоритма Гарнера
+#define NTT_P1_INV_P2   163395495u  // P1^(-1) mod P2
+#define NTT_P1P2_INV_P3 666154164u  // (P1 * P2)^(-1) mod P3
+#define NTT_P1_MOD_P3   503316479u  // P1 mod P3
+
+
+
+// Функция редукции Монтгомери
+static inline uint32_t mont_reduce(uint64_t t, const ntt_prime* q) {
+/**
+ * @brief Возвращает t * 2^(-32) mod p для t < p * 2^32
+ */
+    uint32_t m = (uint32_t)t * q->pinv;
+    uint32_t r = (uint32_t)((t + (uint64_t)m * q->p) >> 32);
+    return r >= q->p ? r - q->p : r;
+}
+
+
+
+// Функция умножения в форме Монтгомери
+static inline uint32_t mont_mul(uint32_t a, uint32_t b, const ntt_prime* q) {
+    return mont_reduce((uint64_t)a * b, q);
+}
+
+
+
+// Функция возведения в степень по модулю (обычная форма)
+static uint32_t mod_pow(uint32_t a, uint64_t e, uint32_t p) {
+    uint64_t result = 1, base = a % p;
+    while (e > 0) {
+        if (e & 1) {
+            result = result * base % p;
+        }
+        base = base * base % p;
+        e >>= 1;
+    }
+    return (uint32_t)result;
+}
+
+
+
+// Функция вычисления корней всех этапов преобразования
+static void ntt_roots(uint32_t* roots, size_t n, const ntt_prime* q) {
+/**
+ * @brief roots[half + j] = w_len^j (форма Монтгомери) для каждого этапа (half = len / 2),
+ *        где w_len - корень степени len из единицы: корни этапа лежат подряд
+ */
+    for (size_t half = 1; half < n; half <<= 1) {
+        uint32_t w = mont_mul(mod_pow(q->g, (q->p - 1) / (2 * half), q->p), q->r2, q);
+        roots[half] = mont_reduce(q->r2, q);
+        for (size_t j = 1; j < half; j++) {
+            roots[half + j] = mont_mul(roots[half + j - 1], w, q);
+        }
+    }
+}
+
+
+
+// Функция перевода множителя в форму Монтгомери с дополнением нулями до n
+static void ntt_load(uint32_t* fa, const uint32_t* a, size_t na, size_t n, const ntt_prime* q) {
+    // mont_reduce(x * 2^64) = x * 2^32 mod p: перевод в форму Монтгомери без отдельного деления
+    for (size_t i = 0; i < na; i++) {
+        fa[i] = mont_reduce((uint64_t)a[i] * q->r2, q);
+    }
+    memset(fa + na, 0, (n - na) * sizeof(uint32_t));
+}
+
+
+
+// Функция бит-реверсной перестановки
+static void ntt_bit_reverse(uint32_t* a, size_t n) {
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j |= bit;
+        if (i < j) {
+            uint32_t t = a[i];
+            a[i] = a[j];
+            a[j] = t;
+        }
+    }
+}
+
+
+
+// Функция части одного этапа преобразования
+static void ntt_stage(uint32_t* a, size_t len, const uint32_t* roots, const ntt_prime* q, size_t first, size_t last) {
+/**
+ * @brief Выполняет бабочки с номерами first..last - 1 этапа длины len
+ *
+ * @note Бабочка t относится к блоку t / half и позиции t % half в нём (half = len / 2);
+ *       разные диапазоны бабочек одного этапа независимы
+ */
+    const uint32_t p = q->p;
+    const size_t half = len / 2;
+    const uint32_t* w = roots + half;
+    size_t block = first / half;
+    size_t j = first % half;
+
+    for (size_t t = first; t < last; block++, j = 0) {
+        size_t end = (last - t < half - j) ? j + (last - t) : half;
+        uint32_t* x = a + block * len;
+        t += end - j;
+        for (; j < end; j++) {
+            uint32_t u = x[j];
+            uint32_t v = mont_mul(x[j + half], w[j], q);
+            uint32_t s = u + v;
+            x[j] = s >= p ? s - p : s;
+            x[j + half] = u >= v ? u - v : u + p - v;
+        }
+    }
+}
+
+
+
+// Функция прямого преобразования (значения и корни в форме Монтгомери)
+static void ntt_transform(uint32_t* a, size_t n, const uint32_t* roots, const ntt_prime* q) {
+/**
+ * @brief Итеративное преобразование с прореживанием по времени
+ *
+ * @param roots Корни этапов (ntt_roots)
+ */
+    ntt_bit_reverse(a, n);
+    for (size_t len = 2; len <= n; len <<= 1) {
+        ntt_stage(a, len, roots, q, 0, n / 2);
+    }
+}
+
+
+
+// Функция завершения обратного преобразования
+static void ntt_inverse_finish(uint32_t* fa, size_t n, const ntt_prime* q) {
+/**
+ * @brief Обратное преобразование - прямое с разворотом fa[1..n) и делением на n
+ *
+ * @note Умножение на n^(-1) в обычной форме одновременно выводит значения из формы Монтгомери
+ */
+    for (size_t i = 1, j = n - 1; i < j; i++, j--) {
+        uint32_t t = fa[i];
+        fa[i] = fa[j];
+        fa[j] = t;
+    }
+    uint32_t n_inv = mod_pow((uint32_t)(n % q->p), q->p - 2, q->p);
+    for (size_t i = 0; i < n; i++) {
+        fa[i] = mont_mul(fa[i], n_inv, q);
+    }
+}
+
+
+
+// Функция свёртки по одному модулю
+static int ntt_convolve(uint32_t* fa, const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                        size_t n, const ntt_prime* q) {
+/**
+ * @brief Записывает в fa[0..n) свёртку a и b по модулю q->p (обычная форма)
+ *
+ * @return int 0 при успехе, -1 при ошибке выделения памяти
+ */
+    int square = (a == b && na == nb);
+    uint32_t* roots = (uint32_t*)malloc(n * sizeof(uint32_t));
+    uint32_t* fb = square ? NULL : (uint32_t*)malloc(n * sizeof(uint32_t));
+    if (!roots || (!square && !fb)) {
+        free(roots);
+        free(fb);
+        return -1;
+    }
+
+    ntt_roots(roots, n, q);
+    ntt_load(fa, a, na, n, q);
+    ntt_transform(fa, n, roots, q);
+
+    if (square) {
+        for (size_t i = 0; i < n; i++) {
+            fa[i] = mont_mul(fa[i], fa[i], q);
+        }
+    } else {
+        ntt_load(fb, b, nb, n, q);
+        ntt_transform(fb, n, roots, q);
+        for (size_t i = 0; i < n; i++) {
+            fa[i] = mont_mul(fa[i], fb[i], q);
+        }
+    }
+
+    // Обратное преобразование
+    ntt_transform(fa, n, roots, q);
+    ntt_inverse_finish(fa, n, q);
+
+    free(roots);
+    free(fb);
+    return 0;
+}
+
+
+
+// Этапы параллельной свёртки
+enum {
+    NTT_PHASE_PREPARE,    // корни, перевод множителей и перестановка (задача на массив)
+    NTT_PHASE_STAGE,      // один этап преобразования всех массивов (задачи по NTT_PARALLEL_CHUNK бабочек)
+    NTT_PHASE_POINTWISE,  // поточечное умножение и перестановка перед обратным преобразованием
+    NTT_PHASE_FINISH      // завершение обратного преобразования (задача на модуль)
+};
+
+// Данные параллельной свёртки по трём модулям
+typedef struct {
+    const uint32_t* a;
+    size_t na;
+    const uint32_t* b;
+    size_t nb;
+    uint32_t* fa[3];     // преобразования a, затем свёртки по модулям
+    uint32_t* fb[3];     // преобразования b (не используются при возведении в квадрат)
+    uint32_t* roots[3];
+    size_t n;
+    size_t len;          // длина текущего этапа
+    int phase;
+} ntt_parallel_ctx;
+
+
+
+// Функция задачи параллельной свёртки
+static void ntt_parallel_task(void* arg, size_t index) {
+/**
+ * @brief Выполняет задачу index текущего этапа: массивы 0-2 - fa по модулям, 3-5 - fb
+ */
+    const ntt_parallel_ctx* ctx = (const ntt_parallel_ctx*)arg;
+    size_t n = ctx->n;
+
+    switch (ctx->phase) {
+        case NTT_PHASE_PREPARE: {
+            const ntt_prime* q = &ntt_primes[index % 3];
+            if (index < 3) {
+                ntt_roots(ctx->roots[index], n, q);
+                ntt_load(ctx->fa[index], ctx->a, ctx->na, n, q);
+                ntt_bit_reverse(ctx->fa[index], n);
+            } else {
+                ntt_load(ctx->fb[index - 3], ctx->b, ctx->nb, n, q);
+                ntt_bit_reverse(ctx->fb[index - 3], n);
+            }
+            break;
+        }
+        case NTT_PHASE_STAGE: {
+            size_t chunks = n / 2 / NTT_PARALLEL_CHUNK;
+            size_t array = index / chunks;
+            size_t first = index % chunks * NTT_PARALLEL_CHUNK;
+            uint32_t* x = array < 3 ? ctx->fa[array] : ctx->fb[array - 3];
+            ntt_stage(x, ctx->len, ctx->roots[array % 3], &ntt_primes[array % 3], first, first + NTT_PARALLEL_CHUNK);
+            break;
+        }
+        case NTT_PHASE_POINTWISE: {
+            const ntt_prime* q = &ntt_primes[index];
+            uint32_t* fa = ctx->fa[index];
+            const uint32_t* fb = ctx->fb[index] ? ctx->fb[index] : fa;
+            for (size_t i = 0; i < n; i++) {
+                fa[i] = mont_mul(fa[i], fb[i], q);
+            }
+            ntt_bit_reverse(fa, n);
+            break;
+        }
+        default:
+            ntt_inverse_finish(ctx->fa[index], n, &ntt_primes[index]);
+            break;
+    }
+}
+
+
+
+// Функция свёртки по трём модулям на пуле потоков
+static int ntt_convolve_parallel(uint32_t* const res[3], const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+                                 size_t n, thread_pool* pool) {
+/**
+ * @brief Записывает в res[k][0..n) свёртку a и b по модулю ntt_primes[k]
+ *
+ * @return int 0 при успехе, -1 при ошибке выделения памяти
+ *
+ * @note Модули независимы, а бабочки одного этапа делятся на участки, поэтому работы
+ *       хватает всем потокам даже для единственного умножения (верхние уровни перевода)
+ */
+    int square = (a == b && na == nb);
+    int arrays = square ? 3 : 6;
+    uint32_t* buffer = (uint32_t*)malloc((size_t)(arrays + 3) * n * sizeof(uint32_t));
+    if (!buffer) {
+        return -1;
+    }
+
+    ntt_parallel_ctx ctx = {a, na, b, nb, {res[0], res[1], res[2]}, {NULL, NULL, NULL}, {NULL, NULL, NULL}, n, 0, 0};
+    for (int k = 0; k < 3; k++) {
+        ctx.roots[k] = buffer + (size_t)k * n;
+        if (!square) {
+            ctx.fb[k] = buffer + (size_t)(3 + k) * n;
+        }
+    }
+    size_t chunks = n / 2 / NTT_PARALLEL_CHUNK;
+
+    ctx.phase = NTT_PHASE_PREPARE;
+    thread_pool_run(pool, arrays, ntt_parallel_task, &ctx);
+    ctx.phase = NTT_PHASE_STAGE;
+    for (ctx.len = 2; ctx.len <= n; ctx.len <<= 1) {
+        thread_pool_run(pool, arrays * chunks, ntt_parallel_task, &ctx);
+    }
+
+    ctx.phase = NTT_PHASE_POINTWISE;
+    thread_pool_run(pool, 3, ntt_parallel_task, &ctx);
+    ctx.phase = NTT_PHASE_STAGE;
+    for (ctx.len = 2; ctx.len <= n; ctx.len <<= 1) {
+        thread_pool_run(pool, 3 * chunks, ntt_parallel_task, &ctx);
+    }
+    ctx.phase = NTT_PHASE_FINISH;
+    thread_pool_run(pool, 3, ntt_parallel_task, &ctx);
+
+    free(buffer);
+    return 0;
+}
+
+
+
+// Функция сборки коэффициентов свёртки и переноса по основанию base
+static inline void ntt_carry(uint32_t* r, size_t rn, uint32_t* const res[3], uint64_t base) {
+/**
+ * @brief По остаткам трёх модулей восстанавливает коэффициенты (алгоритм Гарнера)
+ *        и раскладывает их с переносами в слова по основанию base
+ *
+ * @note Коэффициент меньше 2^90, накопитель переноса хранится двумя 64-битными половинами
+ */
+    uint64_t acc_lo = 0, acc_hi = 0;
+    for (size_t k = 0; k < rn; k++) {
+        if (k + 1 < rn) {
+            uint64_t x1 = res[0][k];
+            uint64_t x2 = (res[1][k] + NTT_P2 - x1 % NTT_P2) * NTT_P1_INV_P2 % NTT_P2;
+            uint64_t x12 = (x1 + x2 * NTT_P1_MOD_P3) % NTT_P3;
+            uint64_t x3 = (res[2][k] + NTT_P3 - x12) * NTT_P1P2_INV_P3 % NTT_P3;
+
+            // value = x1 + P1 * (x2 + P2 * x3)
+            uint64_t t = x2 + x3 * NTT_P2;
+            uint64_t low = x1 + (t & 0xFFFFFFFFu) * NTT_P1;
+            uint64_t mid = (t >> 32) * NTT_P1;
+            uint64_t lo = low + (mid << 32);
+            uint64_t hi = (mid >> 32) + (lo < low);
+
+            acc_lo += lo;
+            acc_hi += hi + (acc_lo < lo);
+        }
+
+        if (base == ((uint64_t)1 << 32)) {
+            r[k] = (uint32_t)acc_lo;
+            acc_lo = (acc_lo >> 32) | (acc_hi << 32);
+            acc_hi >>= 32;
+        } else {
+            // Деление 128-битного накопителя на base по 32-битным словам
+            uint64_t rem = 0;
+            uint64_t cur = rem << 32 | (acc_hi >> 32);
+            uint64_t q3 = cur / base;
+            rem = cur % base;
+            cur = rem << 32 | (acc_hi & 0xFFFFFFFFu);
+            uint64_t q2 = cur / base;
+            rem = cur % base;
+            cur = rem << 32 | (acc_lo >> 32);
+            uint64_t q1 = cur / base;
+            rem = cur % base;
+            cur = rem << 32 | (acc_lo & 0xFFFFFFFFu);
+            uint64_t q0 = cur / base;
+            rem = cur % base;
+
+            r[k] = (uint32_t)rem;
+            acc_hi = q3 << 32 | q2;
+            acc_lo = q1 << 32 | q0;
+        }
+    }
+}
+
+
+
+// Функция умножения через NTT
+static int mul_ntt(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint64_t base,
+                   thread_pool* pool) {
+/**
+ * @brief r = a * b, na + nb <= NTT_MAX_LEN
+ *
+ * @param pool Пул потоков для длинных преобразований (NULL - в вызывающем потоке)
+ * @return int 0 при успехе, -1 при ошибке выделения памяти
+ */
+    size_t rn = na + nb;
+    size_t n = 1;
+    while (n < rn - 1) {
+        n <<= 1;
+    }
+
+    uint32_t* res[3];
+    uint32_t* buffer = (uint32_t*)malloc(3 * n * sizeof(uint32_t));
+    if (!buffer) {
+        return -1;
+    }
+    for (int k = 0; k < 3; k++) {
+        res[k] = buffer + k * n;
+    }
+    if (thread_pool_size(pool) > 1 && n >= NTT_PARALLEL_MIN_LEN) {
+        if (ntt_convolve_parallel(res, a, na, b, nb, n, pool) != 0) {
+            free(buffer);
+            return -1;
+        }
+    } else {
+        for (int k = 0; k < 3; k++) {
+            if (ntt_convolve(res[k], a, na, b, nb, n, &ntt_primes[k]) != 0) {
+                free(buffer);
+                return -1;
+            }
+        }
+    }
+
+    switch (base) {
+        case (uint64_t)1 << 32:
+            ntt_carry(r, rn, res, (uint64_t)1 << 32);
+            break;
+        case BASE58_LIMB:
+            ntt_carry(r, rn, res, BASE58_LIMB);
+            break;
+        case BASE62_LIMB:
+            ntt_carry(r, rn, res, BASE62_LIMB);
+            break;
+        default:
+            ntt_carry(r, rn, res, base);
+            break;
+    }
+
+    free(buffer);
+    return 0;
+}
+
+
+
+// Функция умножения в столбик
+static inline void mul_school(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint64_t base) {
+/**
+ * @note Промежуточное значение a[i] * b[j] + r[i + j] + перенос не превосходит base^2 - 1
+ */
+    memset(r, 0, (na + nb) * sizeof(uint32_t));
+    for (size_t i = 0; i < na; i++) {
+        uint64_t ai = a[i];
+        uint64_t carry = 0;
+        if (ai == 0) {
+            continue;
+        }
+        for (size_t j = 0; j < nb; j++) {
+            uint64_t t = ai * b[j] + r[i + j] + carry;
+            r[i + j] = (uint32_t)(t % base);
+            carry = t / base;
+        }
+        r[i + nb] = (uint32_t)carry;
+    }
+}
+
+
+
+// Функция сложения со сдвигом для конкретного основания
+static inline size_t add_limbs(uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint64_t base) {
+    size_t n = na > nb ? na : nb;
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t t = carry + (i < na ? a[i] : 0) + (i < nb ? b[i] : 0);
+        carry = t >= base;
+        a[i] = (uint32_t)(carry ? t - base : t);
+    }
+    if (carry) {
+        a[n++] = 1;
+    }
+    return n;
+}
+
+
+
+// Функция прибавления b к a
+size_t bignum_add(uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t base) {
+/**
+ * @brief a = a + b
+ *
+ * @param a Первое слагаемое и результат (место для max(na, nb) + 1 слов)
+ * @param na Количество слов a
+ * @param b Второе слагаемое
+ * @param nb Количество слов b
+ * @param base Основание слова (BIGNUM_BINARY для 2^32)
+ * @return size_t Количество слов результата
+ */
+    switch (base) {
+        case BIGNUM_BINARY:
+            return add_limbs(a, na, b, nb, (uint64_t)1 << 32);
+        case BASE58_LIMB:
+            return add_limbs(a, na, b, nb, BASE58_LIMB);
+        case BASE62_LIMB:
+            return add_limbs(a, na, b, nb, BASE62_LIMB);
+        default:
+            return add_limbs(a, na, b, nb, base);
+    }
+}
+
+
+
+// Функция отбрасывания старших нулевых слов
+size_t bignum_normalize(const uint32_t* a, size_t n) {
+    while (n > 0 && a[n - 1] == 0) {
+        n--;
+    }
+    return n;
+}
+
+
+
+// Функция умножения r = a * b в словах по основанию base
+int bignum_mul(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t base) {
+/**
+ * @brief Умножает два числа в вызывающем потоке (см. bignum_mul_parallel)
+ */
+    return bignum_mul_parallel(r, a, na, b, nb, base, NULL);
+}
+
+
+
+// Функция умножения r = a * b на пуле потоков
+int bignum_mul_parallel(uint32_t* r, const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t base,
+                        thread_pool* pool) {
+/**
+ * @brief Умножает два числа, выбирая алгоритм по размеру
+ *
+ * @param r Результат (na + nb слов, не пересекается с a и b)
+ * @param a Первый множитель
+ * @param na Количество слов a
+ * @param b Второй множитель (может совпадать с a - тогда выполняется возведение в квадрат)
+ * @param nb Количество слов b
+ * @param base Основание слова (BIGNUM_BINARY для 2^32)
+ * @param pool Пул потоков (NULL - в вызывающем потоке): преобразования от NTT_PARALLEL_MIN_LEN
+ *             делятся между потоками
+ * @return int 0 при успехе, -1 при ошибке выделения памяти
+ *
+ * @note Произведения длиннее NTT_MAX_LEN собираются из частей: a = a1 * base^h + a0
+ * @warning Не вызывать из задачи того же пула: пул выполняет одну пачку задач за раз
+ */
+    uint64_t word = (base == BIGNUM_BINARY) ? ((uint64_t)1 << 32) : base;
+
+    if (na == 0 || nb == 0) {
+        memset(r, 0, (na + nb) * sizeof(uint32_t));
+        return 0;
+    }
+
+    if ((na < nb ? na : nb) < NTT_THRESHOLD) {
+        switch (base) {
+            case BIGNUM_BINARY:
+                mul_school(r, a, na, b, nb, (uint64_t)1 << 32);
+                break;
+            case BASE58_LIMB:
+                mul_school(r, a, na, b, nb, BASE58_LIMB);
+                break;
+            case BASE62_LIMB:
+                mul_school(r, a, na, b, nb, BASE62_LIMB);
+                break;
+            default:
+                mul_school(r, a, na, b, nb, word);
+                break;
+        }
+        return 0;
+    }
+
+    if (na + nb <= NTT_MAX_LEN) {
+        return mul_ntt(r, a, na, b, nb, word, pool);
+    }
+
+    // Слишком длинное произведение: делим больший множитель пополам
+    if (na < nb) {
+        const uint32_t* t = a;
+        a = b;
+        b = t;
+        size_t tn = na;
+        na = nb;
+        nb = tn;
+    }
+    size_t h = na / 2;
+    uint32_t* high = (uint32_t*)malloc((na - h + nb) * sizeof(uint32_t));
+    if (!high) {
+        return -1;
+    }
+    if (bignum_mul_parallel(r, a, h, b, nb, base, pool) != 0 ||
+        bignum_mul_parallel(high, a + h, na - h, b, nb, base, pool) != 0) {
+        free(high);
+        return -1;
+    }
+    // r = a0 * b + (a1 * b) * base^h; старшие слова r за пределами h + nb ещё не заполнены
+    memset(r + h + nb, 0, (na - h) * sizeof(uint32_t));
+    bignum_add(r + h, nb, high, na - h + nb, base);
+    free(high);
+    return 0;
+}
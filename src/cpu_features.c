@@ -0,0 +1,188 @@
+/**
+ * @file cpu_features.c
+ * @brief Определение набора инструкций процессора во время выполнения (cpuid)
+ * 
+ * @note На AArch64 возвращает CPU_NEON, на остальных платформах 0 - используются
+ *       скалярные (SWAR) реализации
+ * @note Уровень можно понизить переменной окружения BASE_CPU или вызовом cpu_features_limit()
+ *       (например, для сравнения ядер на одной машине)
+ */
+
+#include "../include/cpu_features.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef CPU_X86
+#include <cpuid.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CPU_POSIX 1
+#include <pthread.h>
+#endif
+
+
+
+// Уровни наборов инструкций от младшего к старшему
+static const struct {
+    const char* name;
+    unsigned int mask;
+} cpu_tiers[] = {
+    {"scalar", 0},
+    {"sse2",   CPU_SSE2},
+    {"ssse3",  CPU_SSE2 | CPU_SSSE3},
+    {"avx2",   CPU_SSE2 | CPU_SSSE3 | CPU_AVX2},
+    {"avx512", CPU_SSE2 | CPU_SSSE3 | CPU_AVX2 | CPU_AVX512BW | CPU_AVX512VBMI},
+    {"neon",   CPU_NEON},
+};
+
+#define CPU_TIER_COUNT (sizeof(cpu_tiers) / sizeof(cpu_tiers[0]))
+
+#ifdef CPU_POSIX
+static pthread_once_t detected = PTHREAD_ONCE_INIT;
+#else
+static int detected = 0;
+#endif
+static unsigned int features = 0;
+
+
+
+#ifdef CPU_X86
+// Функция чтения регистра XCR0 (какие регистры сохраняет операционная система)
+static unsigned int read_xcr0(void) {
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+}
+#endif
+
+
+
+// Функция поиска маски уровня по названию
+static int tier_mask(const char* tier, unsigned int* mask) {
+    for (size_t i = 0; i < CPU_TIER_COUNT; i++) {
+        if (strcmp(tier, cpu_tiers[i].name) == 0) {
+            *mask = cpu_tiers[i].mask;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+
+
+// Функция опроса процессора
+static void cpu_detect(void) {
+/**
+ * @brief Заполняет features флагами CPU_* (выполняется один раз, см. cpu_features)
+ * 
+ * @note AVX2 считается доступным, только если ОС сохраняет регистры YMM, а AVX-512 -
+ *       если сохраняются ещё и регистры ZMM и масок (проверка через XGETBV)
+ * @note Если задана переменная окружения BASE_CPU, результат ограничивается этим уровнем
+ */
+
+#ifdef CPU_X86
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+        if (edx & bit_SSE2) {
+            features |= CPU_SSE2;
+        }
+        if (ecx & bit_SSSE3) {
+            features |= CPU_SSSE3;
+        }
+
+        // AVX2 требует поддержки XSAVE и сохранения состояния XMM/YMM операционной системой
+        int os_avx = (ecx & bit_OSXSAVE) && (ecx & bit_AVX) && ((read_xcr0() & 0x6) == 0x6);
+        if (os_avx && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            if (ebx & bit_AVX2) {
+                features |= CPU_AVX2;
+            }
+
+            // AVX-512: дополнительно регистры масок и обе половины ZMM (биты 5-7 XCR0)
+            int os_avx512 = (read_xcr0() & 0xE6) == 0xE6;
+            if (os_avx512 && (ebx & bit_AVX512F) && (ebx & bit_AVX512BW)) {
+                features |= CPU_AVX512BW;
+                if (ecx & bit_AVX512VBMI) {
+                    features |= CPU_AVX512VBMI;
+                }
+            }
+        }
+    }
+#endif
+
+#ifdef CPU_ARM64
+    features |= CPU_NEON;
+#endif
+
+    unsigned int mask;
+    const char* tier = getenv(CPU_TIER_ENV);
+    if (tier && tier_mask(tier, &mask) == 0) {
+        features &= mask;
+    }
+}
+
+
+
+// Функция определения возможностей процессора
+unsigned int cpu_features(void) {
+/**
+ * @brief Возвращает набор флагов CPU_* для текущего процессора
+ * 
+ * @return unsigned int Битовая маска поддерживаемых расширений
+ * 
+ * @note Опрос выполняется один раз; с pthreads - через pthread_once, так что первый
+ *       вызов из нескольких потоков сразу безопасен
+ */
+#ifdef CPU_POSIX
+    pthread_once(&detected, cpu_detect);
+#else
+    if (!detected) {
+        cpu_detect();
+        detected = 1;
+    }
+#endif
+    return features;
+}
+
+
+
+// Функция ограничения используемых расширений
+int cpu_features_limit(const char* tier) {
+/**
+ * @brief Оставляет только расширения, входящие в уровень tier
+ * 
+ * @param tier Название уровня: "scalar", "sse2", "ssse3", "avx2", "avx512" или "neon"
+ * @return int 0 при успехе, -1 если уровень неизвестен
+ * 
+ * @note Повысить уровень выше возможностей процессора нельзя.
+ * @warning Ядра кодеков выбираются при первом вызове, поэтому функцию нужно
+ *          вызывать до начала кодирования и до запуска потоков (например, при разборе
+ *          аргументов): сама маска не защищена от одновременного чтения
+ */
+    unsigned int mask;
+    if (tier_mask(tier, &mask) != 0) {
+        return -1;
+    }
+    features = cpu_features() & mask;
+    return 0;
+}
+
+
+
+// Функция получения названия уровня
+const char* cpu_tier_name(void) {
+/**
+ * @brief Возвращает название наивысшего уровня, все расширения которого доступны
+ * 
+ * @return const char* Название уровня (строковая константа)
+ */
+    unsigned int current = cpu_features();
+    const char* name = cpu_tiers[0].name;
+    for (size_t i = 1; i < CPU_TIER_COUNT; i++) {
+        if ((current & cpu_tiers[i].mask) == cpu_tiers[i].mask) {
+            name = cpu_tiers[i].name;
+        }
+    }
+    return name;
+}
@@ -16,26 +16,275 @@
 
 #include "../include/decod_func.h"
 #include "../include/tables.h"
+#include "../include/cpu_features.h"
+#include "../include/radix.h"
+#include "../include/swar.h"
+#include "../include/parallel.h"
 
+#ifdef CPU_X86
+#include <immintrin.h>
+#endif
 
+#ifdef CPU_ARM64
+#include <arm_neon.h>
+#endif
 
-// Функция поиска декодированного символа
-int find_index(char c, const char table[]) {
+#if defined(__unix__) || defined(__APPLE__)
+#define DECODE_POSIX 1
+#include <pthread.h>
+#endif
+
+
+
+// Векторное ядро декодирует начало входа до первого недопустимого блока
+// и возвращает число обработанных символов
+typedef size_t (*decode_kernel)(const unsigned char* input, size_t len, unsigned char* output);
+
+// Ядра, выбранные для текущего процессора (NULL - только скалярный цикл)
+typedef struct {
+    decode_kernel base16;
+    decode_kernel base32;
+    decode_kernel base64;
+    size_t (*base85)(const unsigned char* input, size_t len, unsigned char* output, int strict);
+} decode_kernels;
+
+static const decode_kernels* decode_dispatch(void);
+
+
+
+// Функция декодирования блоками по 8 символов (SWAR)
+static size_t base16_decode_swar(const unsigned char* input, size_t len, unsigned char* output) {
 /**
- * @brief Поиск индекса символа в заданной таблице
+ * @brief Проверяет и декодирует 8 символов HEX в 4 байта одним 64-битным словом
  * 
- * @param c Символ для поиска
- * @param table Таблица символов для поиска
- * @return int Индекс символа или -1 если не найден
+ * @return size_t Количество обработанных символов (кратно 8)
  * 
- * @note Используется всеми функциями декодирования для преобразования символов
+ * @note Принадлежность диапазонам '0'-'9' и 'a'-'f' (после перевода в нижний регистр)
+ *       проверяется сразу для всех байтов слова; на блоке с недопустимым символом
+ *       ядро останавливается, и ошибку сообщает скалярный код
  */
-    for (int i = 0; table[i] != '\0'; i++) {
-        if (table[i] == c) {
-            return i;
+    size_t i = 0;
+    for (; len - i >= 8; i += 8) {
+        const uint64_t c = swar_load_be64(input + i);
+        const uint64_t lower = c | 0x20 * SWAR_ONES;
+        const uint64_t digits = swar_ge(c, '0') & swar_le(c, '9');
+        const uint64_t letters = swar_ge(lower, 'a') & swar_le(lower, 'f');
+        if ((c & SWAR_HIGH) | ((digits | letters) ^ SWAR_HIGH)) {
+            break;
+        }
+
+        // Значения полубайтов: младшие 4 бита символа, для букв ещё + 9
+        uint64_t x = (c & 0x0F * SWAR_ONES) + (letters >> 7) * 9;
+        // Пары полубайтов -> байты, затем байты сдвигаются вплотную
+        x = ((x >> 4) & 0x00F000F000F000F0ULL) | (x & 0x000F000F000F000FULL);
+        x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+        x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+        swar_store_be(output + i / 2, x, 4);
+    }
+    return i;
+}
+
+
+
+#ifdef CPU_ARM64
+// Функция декодирования блоками по 32 символа (NEON)
+static size_t base16_decode_neon(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 32 символа HEX в 16 байт за итерацию
+ * 
+ * @return size_t Количество обработанных символов (кратно 32)
+ * 
+ * @note vld2 разделяет старшие и младшие полубайты; на блоке с недопустимым символом
+ *       ядро останавливается, и ошибку сообщает скалярный код
+ */
+    size_t i = 0;
+    for (; len - i >= 32; i += 32) {
+        const uint8x16x2_t in = vld2q_u8(input + i);
+        uint8x16_t values[2];
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+
+        for (int k = 0; k < 2; k++) {
+            const uint8x16_t digit = vsubq_u8(in.val[k], vdupq_n_u8('0'));
+            const uint8x16_t letter = vsubq_u8(vorrq_u8(in.val[k], vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+            const uint8x16_t is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+            const uint8x16_t is_letter = vcltq_u8(letter, vdupq_n_u8(6));
+            values[k] = vbslq_u8(is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+            valid = vandq_u8(valid, vorrq_u8(is_digit, is_letter));
+        }
+        if (vminvq_u8(valid) == 0) {
+            break;
+        }
+        vst1q_u8(output + i / 2, vorrq_u8(vshlq_n_u8(values[0], 4), values[1]));
+    }
+    return i;
+}
+#endif
+
+
+
+#ifdef CPU_X86
+// Функция перевода 16 символов HEX в значения полубайтов (SSSE3)
+__attribute__((target("ssse3")))
+static inline __m128i base16_nibbles_ssse3(__m128i in, __m128i* valid) {
+/**
+ * @brief Переводит символы 0-9, A-F, a-f в значения 0-15
+ * 
+ * @param in 16 символов
+ * @param valid Маска корректных символов (0xFF для символа из алфавита)
+ * @return __m128i Значения полубайтов (для некорректных символов - 0)
+ * 
+ * @note Проверка диапазона выполняется вычитанием и беззнаковым сравнением через min
+ */
+    const __m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+
+    // Установка бита 0x20 приводит заглавные буквы к строчным
+    const __m128i alpha = _mm_sub_epi8(_mm_or_si128(in, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(alpha, _mm_set1_epi8(5)), alpha);
+
+    *valid = _mm_or_si128(is_digit, is_alpha);
+    return _mm_or_si128(_mm_and_si128(is_digit, digit),
+                        _mm_and_si128(is_alpha, _mm_add_epi8(alpha, _mm_set1_epi8(10))));
+}
+
+
+
+// Функция декодирования блоками по 32 символа (SSSE3)
+__attribute__((target("ssse3")))
+static size_t base16_decode_ssse3(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Декодирует 32 символа HEX в 16 байт за итерацию
+ * 
+ * @return size_t Количество обработанных символов; на блоке с некорректным символом
+ *         останавливается, чтобы ошибку сообщил скалярный код
+ */
+    // Пара полубайтов (старший, младший) -> старший * 16 + младший
+    const __m128i merge = _mm_set1_epi16(0x0110);
+    size_t i = 0;
+
+    for (; len - i >= 32; i += 32) {
+        __m128i valid0, valid1;
+        const __m128i v0 = base16_nibbles_ssse3(_mm_loadu_si128((const __m128i*)(input + i)), &valid0);
+        const __m128i v1 = base16_nibbles_ssse3(_mm_loadu_si128((const __m128i*)(input + i + 16)), &valid1);
+        if (_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF) {
+            break;
+        }
+
+        const __m128i w0 = _mm_maddubs_epi16(v0, merge);
+        const __m128i w1 = _mm_maddubs_epi16(v1, merge);
+        _mm_storeu_si128((__m128i*)(output + i / 2), _mm_packus_epi16(w0, w1));
+    }
+    return i;
+}
+
+
+
+// Функция перевода 32 символов HEX в значения полубайтов (AVX2)
+__attribute__((target("avx2")))
+static inline __m256i base16_nibbles_avx2(__m256i in, __m256i* valid) {
+/**
+ * @brief 256-битный вариант base16_nibbles_ssse3
+ */
+    const __m256i digit = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+    const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+
+    const __m256i alpha = _mm256_sub_epi8(_mm256_or_si256(in, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(alpha, _mm256_set1_epi8(5)), alpha);
+
+    *valid = _mm256_or_si256(is_digit, is_alpha);
+    return _mm256_or_si256(_mm256_and_si256(is_digit, digit),
+                           _mm256_and_si256(is_alpha, _mm256_add_epi8(alpha, _mm256_set1_epi8(10))));
+}
+
+
+
+// Функция декодирования блоками по 64 символа (AVX2)
+__attribute__((target("avx2")))
+static size_t base16_decode_avx2(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Декодирует 64 символа HEX в 32 байта за итерацию
+ * 
+ * @return size_t Количество обработанных символов; на блоке с некорректным символом
+ *         останавливается, чтобы ошибку сообщил скалярный код
+ */
+    const __m256i merge = _mm256_set1_epi16(0x0110);
+    size_t i = 0;
+
+    for (; len - i >= 64; i += 64) {
+        __m256i valid0, valid1;
+        const __m256i v0 = base16_nibbles_avx2(_mm256_loadu_si256((const __m256i*)(input + i)), &valid0);
+        const __m256i v1 = base16_nibbles_avx2(_mm256_loadu_si256((const __m256i*)(input + i + 32)), &valid1);
+        if (_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1) {
+            break;
+        }
+
+        const __m256i w0 = _mm256_maddubs_epi16(v0, merge);
+        const __m256i w1 = _mm256_maddubs_epi16(v1, merge);
+        // packus работает внутри 128-битных половин: восстанавливаем порядок 64-битных частей
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(w0, w1), 0xD8);
+        _mm256_storeu_si256((__m256i*)(output + i / 2), packed);
+    }
+    return i;
+}
+#endif
+
+
+
+// Функция наибольшей длины результата декодирования base16
+size_t base16_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает длину результата декодирования len символов HEX (точную для чётного len)
+ */
+    return len / 2;
+}
+
+
+
+// Функция декодирования base16 в буфер вызывающего
+size_t base16_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует данные из Base16 без выделения памяти
+ * 
+ * @param input Указатель на входные данные в Base16
+ * @param len Длина входных данных (чётная)
+ * @param output Буфер для результата
+ * @param cap Размер буфера (не меньше base16_decoded_max_len(len))
+ * @return size_t Количество записанных байтов или BASE_ERROR (нечётная длина,
+ *         недопустимый символ, буфер мал)
+ * 
+ * @note Регистр букв A-F не важен; основная часть данных декодируется векторным ядром,
+ *       выбранным по cpuid
+ */
+    // Проверка на четность длины входных данных
+    if (len % 2 != 0) {
+        return BASE_ERROR;
+    }
+    if (cap < base16_decoded_max_len(len)) {
+        return BASE_ERROR;
+    }
+
+    size_t i = 0;
+
+    const decode_kernels* kernels = decode_dispatch();
+    if (kernels->base16) {
+        i = kernels->base16(input, len, output);
+    }
+
+    // Декодирование оставшейся части
+    for (; i < len; i += 2) {
+        unsigned char high_nibble = base16_rev_table[input[i]];
+        unsigned char low_nibble = base16_rev_table[input[i + 1]];
+
+        // Проверка на корректность символов
+        if (high_nibble == BASE_INVALID || low_nibble == BASE_INVALID) {
+            return BASE_ERROR;
         }
+
+        // Сборка байта из двух полубайтов
+        output[i / 2] = (high_nibble << 4) | low_nibble;
     }
-    return -1; // Символ не найден
+
+    return len / 2;
 }
 
 
@@ -50,431 +299,2144 @@ unsigned char* base16_decode(const unsigned char* input, size_t len, unsigned ch
  * @param output Буфер для записи результата (должен быть размером len/2)
  * @return unsigned char* Указатель на декодированные данные или NULL при ошибке
  * 
- * @note Входная строка должна иметь четную длину
+ * @note Входная строка должна иметь четную длину, регистр букв A-F не важен
+ * @note Декодирует через base16_decode_into
  * @example
  * const unsigned char encoded[] = "48656C6C6F"; // "Hello" в HEX
  * unsigned char decoded[5];
  * base16_decode(encoded, 10, decoded); // Результат: "Hello"
  */
-    // Проверка на четность длины входных данных
     if (len % 2 != 0) {
         fprintf(stderr, "Error: Input length must be even.\n");
         return NULL;
     }
+    if (base16_decode_into(input, len, output, base16_decoded_max_len(len)) == BASE_ERROR) {
+        fprintf(stderr, "Error: Invalid character in string.\n");
+        return NULL;
+    }
+    return output;
+}
 
-    // Декодирование
-    for (size_t i = 0; i < len; i += 2) {
-        int high_nibble = find_index(input[i], base16_table);
-        int low_nibble = find_index(input[i + 1], base16_table);
 
-        // Проверка на корректность символов
-        if (high_nibble == -1 || low_nibble == -1) {
-            fprintf(stderr, "Error: Invalid character in string.\n");
-            return NULL;
+
+// Функция декодирования блоками по 8 символов (SWAR)
+static size_t base32_decode_swar(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 8 символов Base32 в 5 байт одним 64-битным словом
+ * 
+ * @return size_t Количество обработанных символов (кратно 8)
+ * 
+ * @note Диапазоны 'A'-'Z' и '2'-'7' проверяются сразу для всех байтов слова; на группе
+ *       с недопустимым символом (в том числе '=') ядро останавливается
+ */
+    size_t i = 0, o = 0;
+    for (; len - i >= 8; i += 8, o += 5) {
+        const uint64_t c = swar_load_be64(input + i);
+        const uint64_t letters = swar_ge(c, 'A') & swar_le(c, 'Z');
+        const uint64_t digits = swar_ge(c, '2') & swar_le(c, '7');
+        if ((c & SWAR_HIGH) | ((letters | digits) ^ SWAR_HIGH)) {
+            break;
         }
 
-        // Сборка байта из двух полубайтов
-        output[i / 2] = (high_nibble << 4) | low_nibble;
+        // 'A'-'Z' -> 0-25, '2'-'7' -> 26-31; затем 5-битные значения сдвигаются вплотную
+        uint64_t x = c + (digits >> 7) * ('A' + 26 - '2') - 'A' * SWAR_ONES;
+        x = (x & 0x001F001F001F001FULL) | ((x & 0x1F001F001F001F00ULL) >> 3);
+        x = (x & 0x000003FF000003FFULL) | ((x & 0x03FF000003FF0000ULL) >> 6);
+        x = (x & 0x00000000000FFFFFULL) | ((x & 0x000FFFFF00000000ULL) >> 12);
+        swar_store_be(output + o, x, 5);
     }
-
-    return output;
+    return i;
 }
 
 
 
-// Функция декодирования исходного файла base32 - алгоритмом --- РАБОТАЕТ
-unsigned char* base32_decode(const unsigned char* input, size_t len, size_t* output_len) {
+#ifdef CPU_ARM64
+// Индексы tbl для чередования пяти потоков байтов: потоки 0-3 (0xFF - поток 4)
+static const uint8_t base32_interleave_neon[80] = {
+    0, 16, 32, 48, 0xFF, 1, 17, 33, 49, 0xFF, 2, 18, 34, 50, 0xFF, 3,
+    19, 35, 51, 0xFF, 4, 20, 36, 52, 0xFF, 5, 21, 37, 53, 0xFF, 6, 22,
+    38, 54, 0xFF, 7, 23, 39, 55, 0xFF, 8, 24, 40, 56, 0xFF, 9, 25, 41,
+    57, 0xFF, 10, 26, 42, 58, 0xFF, 11, 27, 43, 59, 0xFF, 12, 28, 44, 60,
+    0xFF, 13, 29, 45, 61, 0xFF, 14, 30, 46, 62, 0xFF, 15, 31, 47, 63, 0xFF
+};
+
+// Индексы tbx для пятого потока (0xFF - байт уже взят из потоков 0-3)
+static const uint8_t base32_interleave_last_neon[80] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0, 0xFF, 0xFF, 0xFF, 0xFF, 1, 0xFF, 0xFF, 0xFF, 0xFF, 2, 0xFF,
+    0xFF, 0xFF, 0xFF, 3, 0xFF, 0xFF, 0xFF, 0xFF, 4, 0xFF, 0xFF, 0xFF, 0xFF, 5, 0xFF, 0xFF,
+    0xFF, 0xFF, 6, 0xFF, 0xFF, 0xFF, 0xFF, 7, 0xFF, 0xFF, 0xFF, 0xFF, 8, 0xFF, 0xFF, 0xFF,
+    0xFF, 9, 0xFF, 0xFF, 0xFF, 0xFF, 10, 0xFF, 0xFF, 0xFF, 0xFF, 11, 0xFF, 0xFF, 0xFF, 0xFF,
+    12, 0xFF, 0xFF, 0xFF, 0xFF, 13, 0xFF, 0xFF, 0xFF, 0xFF, 14, 0xFF, 0xFF, 0xFF, 0xFF, 15
+};
+
+
+
+// Функция декодирования блоками по 128 символов (NEON)
+static size_t base32_decode_neon(const unsigned char* input, size_t len, unsigned char* output) {
 /**
- * @brief Декодирует данные из формата Base32
+ * @brief Проверяет и декодирует 128 символов (16 групп) Base32 в 80 байт за итерацию
  * 
- * @param input Указатель на входные данные в Base32
- * @param len Длина входных данных
- * @param output_len Указатель для записи длины выходных данных
- * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * @return size_t Количество обработанных символов (кратно 128)
  * 
- * @note Автоматически обрабатывает дополнение '='
- * @warning Выделяет память, которую нужно освободить через free()
+ * @note Символы раскладываются по восьми потокам через vld4 по 16 бит и uzp, значения
+ *       берутся из base32_rev_table (tbl/tbx по первым 128 кодам). Пять потоков байтов
+ *       собираются обратно через tbl/tbx по таблицам чередования
+ * @note На блоке с недопустимым символом ядро останавливается
  */
-    size_t padded_len = len;
-    while (padded_len % 8 != 0) {
-        padded_len++; // Учитываем недостающие символы
+    uint8x16x4_t rev_lo, rev_hi;
+    for (int k = 0; k < 4; k++) {
+        rev_lo.val[k] = vld1q_u8(base32_rev_table + 16 * k);
+        rev_hi.val[k] = vld1q_u8(base32_rev_table + 64 + 16 * k);
     }
+    size_t i = 0, o = 0;
 
-    char* padded_input = (char*)malloc(padded_len + 1);
-    if (!padded_input) {
-        fprintf(stderr, "Error: Memory allocation failed.\n");
-        return NULL;
-    }
-    
-    strncpy(padded_input, input, len);
-    memset(padded_input + len, '=', padded_len - len);
-    padded_input[padded_len] = '\0';
-    
-    size_t estimated_size = (padded_len / 8) * 5;
-    unsigned char* output = (unsigned char*)malloc(estimated_size);
-    if (!output) {
-        fprintf(stderr, "Error: Memory allocation failed.\n");
-        free(padded_input);
-        return NULL;
-    }
-    
-    size_t output_pos = 0;
-    for (size_t i = 0; i < padded_len; i += 8) {
-        int indices[8] = {0};
-        for (int j = 0; j < 8; j++) {
-            if (padded_input[i + j] == '=') {
-                indices[j] = 0;
-            } else {
-                indices[j] = find_index(padded_input[i + j], base32_table);
-                if (indices[j] == -1) {
-                    fprintf(stderr, "Error: Invalid character in input string.\n");
-                    free(output);
-                    free(padded_input);
-                    return NULL;
-                }
+    for (; len - i >= 128; i += 128, o += 80) {
+        const uint16x8x4_t first = vld4q_u16((const uint16_t*)(input + i));
+        const uint16x8x4_t second = vld4q_u16((const uint16_t*)(input + i + 64));
+
+        // c[k] - значение k-го символа каждой из 16 групп
+        uint8x16_t c[8];
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (int k = 0; k < 4; k++) {
+            const uint8x16x2_t pair = vuzpq_u8(vreinterpretq_u8_u16(first.val[k]), vreinterpretq_u8_u16(second.val[k]));
+            for (int h = 0; h < 2; h++) {
+                const uint8x16_t chars = pair.val[h];
+                const uint8x16_t values = vqtbx4q_u8(vqtbl4q_u8(rev_lo, chars), rev_hi, vsubq_u8(chars, vdupq_n_u8(64)));
+                invalid = vorrq_u8(invalid, vorrq_u8(values, chars));
+                c[2 * k + h] = values;
             }
         }
-
-        uint64_t value = 0;
-        for (int j = 0; j < 8; j++) {
-            value |= ((uint64_t)indices[j] << (35 - j * 5));
+        if (vmaxvq_u8(invalid) & 0x80) {
+            break;
         }
 
-        output[output_pos++] = (value >> 32) & 0xFF;
-        if (padded_input[i + 2] != '=') {
-            output[output_pos++] = (value >> 24) & 0xFF;
-        }
-        if (padded_input[i + 4] != '=') {
-            output[output_pos++] = (value >> 16) & 0xFF;
-        }
-        if (padded_input[i + 5] != '=') {
-            output[output_pos++] = (value >> 8) & 0xFF;
-        }
-        if (padded_input[i + 6] != '=') {
-            output[output_pos++] = value & 0xFF;
+        uint8x16x4_t b;
+        b.val[0] = vorrq_u8(vshlq_n_u8(c[0], 3), vshrq_n_u8(c[1], 2));
+        b.val[1] = vorrq_u8(vorrq_u8(vshlq_n_u8(c[1], 6), vshlq_n_u8(c[2], 1)), vshrq_n_u8(c[3], 4));
+        b.val[2] = vorrq_u8(vshlq_n_u8(c[3], 4), vshrq_n_u8(c[4], 1));
+        b.val[3] = vorrq_u8(vorrq_u8(vshlq_n_u8(c[4], 7), vshlq_n_u8(c[5], 2)), vshrq_n_u8(c[6], 3));
+        const uint8x16_t b4 = vorrq_u8(vshlq_n_u8(c[6], 5), c[7]);
+
+        for (int r = 0; r < 5; r++) {
+            const uint8x16_t bytes = vqtbl4q_u8(b, vld1q_u8(base32_interleave_neon + 16 * r));
+            vst1q_u8(output + o + 16 * r, vqtbx1q_u8(bytes, b4, vld1q_u8(base32_interleave_last_neon + 16 * r)));
         }
     }
-    
-    free(padded_input);
-    *output_len = output_pos;
-    return output;
+    return i;
 }
+#endif
 
 
 
-// Функция декодирования исходного файла base58 - алгоритмом --- РАБОТАЕТ
-unsigned char* base58_decode(const unsigned char* input, size_t len, size_t* output_len) {
+#ifdef CPU_X86
+// Функция перевода 16 символов Base32 в 5-битные значения (SSSE3)
+__attribute__((target("ssse3")))
+static inline int base32_values_ssse3(__m128i in, __m128i* values) {
 /**
- * @brief Декодирует данные из формата Base58 (используется в Bitcoin)
- * 
- * @param input Указатель на входные данные в Base58
- * @param len Длина входных данных
- * @param output_len Указатель для записи длины выходных данных
- * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * @brief Проверяет символы и переводит 'A'..'Z' в 0..25, '2'..'7' в 26..31
  * 
- * @note Корректно обрабатывает ведущие '1' (кодируют нулевые байты)
- * @warning Выделяет память, которую нужно освободить через free()
+ * @return int 1, если все символы из алфавита (в том числе нет '='), иначе 0
  */
-    size_t zero_count = 0;
-    while (zero_count < len && input[zero_count] == base58_table[0]) {
-        zero_count++;
+    const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)),
+                                        _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), in));
+    const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('2' - 1)),
+                                        _mm_cmpgt_epi8(_mm_set1_epi8('7' + 1), in));
+    if (_mm_movemask_epi8(_mm_or_si128(upper, digit)) != 0xFFFF) {
+        return 0;
     }
+    *values = _mm_add_epi8(_mm_sub_epi8(in, _mm_set1_epi8('A')),
+                           _mm_and_si128(digit, _mm_set1_epi8('A' + 26 - '2')));
+    return 1;
+}
 
-    // Выделяем память для результата
-    size_t size = (len - zero_count) * 733 / 1000 + 1; // Оценка размера выходного буфера
-    unsigned char* output = (unsigned char*)malloc(size);
-    if (!output) {
-        *output_len = 0;
-        return NULL;
-    }
-    memset(output, 0, size);
 
-    size_t output_size = 0;
-    for (size_t i = zero_count; i < len; i++) {
-        int carry = find_index(input[i], base58_table);
-        if (carry == -1) {
-            free(output);
-            *output_len = 0;
-            return NULL;
-        }
 
-        for (size_t j = 0; j < output_size; j++) {
-            carry += (int)output[j] * 58;
-            output[j] = carry % 256;
-            carry /= 256;
-        }
+// Функция декодирования блоками по 16 символов (SSSE3)
+__attribute__((target("ssse3")))
+static size_t base32_decode_ssse3(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 16 символов Base32 в 10 байт за итерацию
+ * 
+ * @return size_t Количество обработанных символов (кратно 16)
+ * 
+ * @note Останавливается на первом блоке с символом вне алфавита (в том числе '=')
+ * @note Записывает по 16 байт, поэтому оставляет скалярному коду не меньше 16 символов
+ */
+    // 40-битные значения групп в младших байтах 64-битных слов -> 5 байт старшим вперёд
+    const __m128i pack = _mm_setr_epi8(4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1);
+    const __m128i mask40 = _mm_set1_epi64x(0xFFFFFFFFFFLL);
+    size_t i = 0, o = 0;
 
-        while (carry > 0) {
-            output[output_size++] = carry % 256;
-            carry /= 256;
+    for (; len - i >= 32; i += 16, o += 10) {
+        __m128i values;
+        if (!base32_values_ssse3(_mm_loadu_si128((const __m128i*)(input + i)), &values)) {
+            break;
         }
+        // 8 пятибитных значений -> 10-битные пары -> 20-битные четвёрки -> 40-битная группа
+        const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0120));
+        const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00010400));
+        const __m128i groups = _mm_or_si128(_mm_and_si128(_mm_slli_epi64(quads, 20), mask40),
+                                            _mm_srli_epi64(quads, 32));
+        _mm_storeu_si128((__m128i*)(output + o), _mm_shuffle_epi8(groups, pack));
     }
+    return i;
+}
+
+
+
+// Функция декодирования блоками по 32 символа (AVX2)
+__attribute__((target("avx2")))
+static size_t base32_decode_avx2(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 32 символа Base32 в 20 байт за итерацию
+ * 
+ * @return size_t Количество обработанных символов (кратно 32)
+ * 
+ * @note Останавливается на первом блоке с символом вне алфавита (в том числе '=')
+ * @note Каждая половина регистра даёт 10 байт и записывается своими 16 байтами,
+ *       поэтому скалярному коду остаётся не меньше 16 символов
+ */
+    const __m256i pack = _mm256_setr_epi8(
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+        4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1);
+    const __m256i mask40 = _mm256_set1_epi64x(0xFFFFFFFFFFLL);
+    size_t i = 0, o = 0;
 
-    // Добавляем нули в начало
-    if (zero_count > 0) {
-        output = (unsigned char*)realloc(output, output_size + zero_count);
-        if (!output) {
-            *output_len = 0;
-            return NULL;
+    for (; len - i >= 48; i += 32, o += 20) {
+        const __m256i in = _mm256_loadu_si256((const __m256i*)(input + i));
+        const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('A' - 1)),
+                                               _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), in));
+        const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(in, _mm256_set1_epi8('2' - 1)),
+                                               _mm256_cmpgt_epi8(_mm256_set1_epi8('7' + 1), in));
+        if (_mm256_movemask_epi8(_mm256_or_si256(upper, digit)) != -1) {
+            break;
         }
-        memmove(output + zero_count, output, output_size);
-        memset(output, 0, zero_count);
-        output_size += zero_count;
-    }
+        const __m256i values = _mm256_add_epi8(_mm256_sub_epi8(in, _mm256_set1_epi8('A')),
+                                               _mm256_and_si256(digit, _mm256_set1_epi8('A' + 26 - '2')));
 
-    for (size_t i = 0; i < output_size / 2; i++){
-        unsigned char temp = output[i];
-        output[i] = output[output_size - i - 1];
-        output[output_size - i - 1] = temp;
+        const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0120));
+        const __m256i quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00010400));
+        const __m256i groups = _mm256_or_si256(_mm256_and_si256(_mm256_slli_epi64(quads, 20), mask40),
+                                               _mm256_srli_epi64(quads, 32));
+        const __m256i packed = _mm256_shuffle_epi8(groups, pack);
+        _mm_storeu_si128((__m128i*)(output + o), _mm256_castsi256_si128(packed));
+        _mm_storeu_si128((__m128i*)(output + o + 10), _mm256_extracti128_si256(packed, 1));
     }
-    
-    output[output_size] = '\0';
-    *output_len = output_size;
-    return output;
+    return i;
 }
 
 
 
-// Функция декодирования исходного файла base62 - алгоритмом --- РАБОТАЕТ
-unsigned char* base62_decode(const unsigned char* input, size_t len, size_t* output_len) {
+// Функция декодирования блоками по 64 символа (AVX-512 VBMI)
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static size_t base32_decode_vbmi(const unsigned char* input, size_t len, unsigned char* output) {
 /**
- * @brief Декодирует данные из формата Base62 (0-9, A-Z, a-z)
+ * @brief Проверяет и декодирует 64 символа Base32 в 40 байт за итерацию
  * 
- * @param input Указатель на входные данные в Base62
- * @param len Длина входных данных
- * @param output_len Указатель для записи длины выходных данных
- * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * @return size_t Количество обработанных символов (кратно 8)
  * 
- * @warning Выделяет память, которую нужно освободить через free()
+ * @note Символы переводятся в значения по base32_rev_table через vpermi2b (первые 128 кодов);
+ *       символ вне алфавита или с установленным старшим битом даёт байт со старшим битом
+ * @note Декодирует все полные группы до первого недопустимого символа (в том числе '=')
+ *       и останавливается; хвост загружается и записывается по маске
  */
-    if (len == 0) {
-        *output_len = 0;
-        return NULL;
-    }
+    const __m512i lookup_lo = _mm512_loadu_si512((const void*)base32_rev_table);
+    const __m512i lookup_hi = _mm512_loadu_si512((const void*)(base32_rev_table + 64));
+    // Сборка 5 байт группы из младших 40 бит каждого 64-битного слова (старший байт первым)
+    const __m512i pack = _mm512_setr_epi32(
+        0x01020304, 0x0A0B0C00, 0x13140809, 0x1C101112, 0x18191A1B, 0x21222324, 0x2A2B2C20, 0x33342829,
+        0x3C303132, 0x38393A3B, 0, 0, 0, 0, 0, 0);
+    size_t i = 0, o = 0;
 
-    for (size_t i = 0; i < len; ++i) {
-        if (find_index(input[i], base62_table) == -1) {
-            *output_len = 0;
-            return NULL;
+    while (len - i >= 8) {
+        size_t n = (len - i >= 64) ? 64 : (len - i) & ~(size_t)7;
+        const __mmask64 in_mask = (n == 64) ? ~(__mmask64)0 : ((__mmask64)1 << n) - 1;
+        const __m512i in = _mm512_maskz_loadu_epi8(in_mask, input + i);
+        const __m512i values = _mm512_permutex2var_epi8(lookup_lo, in, lookup_hi);
+
+        const __mmask64 bad = _mm512_movepi8_mask(_mm512_or_si512(values, in)) & in_mask;
+        if (bad) {
+            n = (size_t)__builtin_ctzll(bad) & ~(size_t)7;
         }
-    }
 
-    size_t buffer_capacity = 2;
-    unsigned char* buffer = (unsigned char*)malloc(buffer_capacity);
-    if (!buffer) {
-        *output_len = 0;
-        return NULL;
-    }
-    buffer[0] = 0;
-    size_t buffer_len = 1;
-
-    for (size_t i = 0; i < len; ++i) {
-        int digit = find_index(input[i], base62_table);
-        uint32_t carry;
-
-        carry = 0;
-        for (size_t j = 0; j < buffer_len; ++j) {
-            uint32_t temp = (uint32_t)buffer[j] * 62 + carry;
-            buffer[j] = (unsigned char)(temp % 256);
-            carry = temp / 256;
-        }
-        while (carry > 0) {
-            if (buffer_len >= buffer_capacity) {
-                buffer_capacity *= 2;
-                unsigned char* new_buffer = (unsigned char*)realloc(buffer, buffer_capacity);
-                if (!new_buffer) {
-                    free(buffer);
-                    *output_len = 0;
-                    return NULL;
-                }
-                buffer = new_buffer;
-            }
-            buffer[buffer_len++] = (unsigned char)(carry % 256);
-            carry /= 256;
-        }
-
-        carry = digit;
-        for (size_t j = 0; j < buffer_len; ++j) {
-            uint32_t temp = (uint32_t)buffer[j] + carry;
-            buffer[j] = (unsigned char)(temp % 256);
-            carry = temp / 256;
-            if (carry == 0) break;
-        }
-        while (carry > 0) {
-            if (buffer_len >= buffer_capacity) {
-                buffer_capacity *= 2;
-                unsigned char* new_buffer = (unsigned char*)realloc(buffer, buffer_capacity);
-                if (!new_buffer) {
-                    free(buffer);
-                    *output_len = 0;
-                    return NULL;
-                }
-                buffer = new_buffer;
-            }
-            buffer[buffer_len++] = (unsigned char)(carry % 256);
-            carry /= 256;
+        // 8 пятибитных значений -> 40-битное число в 64-битном слове
+        const __m512i pairs = _mm512_maddubs_epi16(values, _mm512_set1_epi16(0x0120));
+        const __m512i quads = _mm512_madd_epi16(pairs, _mm512_set1_epi32(0x00010400));
+        const __m512i merged = _mm512_or_si512(_mm512_slli_epi64(quads, 20), _mm512_srli_epi64(quads, 32));
+
+        const __mmask64 out_mask = ((__mmask64)1 << (n / 8 * 5)) - 1;
+        _mm512_mask_storeu_epi8(output + o, out_mask, _mm512_permutexvar_epi8(pack, merged));
+        i += n;
+        o += n / 8 * 5;
+        if (bad) {
+            break;
         }
     }
+    return i;
+}
+#endif
 
-    unsigned char* result = (unsigned char*)malloc(buffer_len);
-    if (!result) {
-        free(buffer);
-        *output_len = 0;
-        return NULL;
-    }
-    for (size_t i = 0; i < buffer_len; ++i) {
-        result[i] = buffer[buffer_len - 1 - i];
-    }
-    free(buffer);
-    
-    result[buffer_len] = '\0';
-    *output_len = buffer_len;
-    return result;
+
+
+// Функция наибольшей длины результата декодирования base32
+size_t base32_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает наибольшую длину результата декодирования len символов Base32
+ * 
+ * @note Дополнение '=' и неполная последняя группа только уменьшают результат
+ */
+    return ((len + 7) / 8) * 5;
 }
 
 
 
-// Функция декодирования исходного файла base64 - алгоритмом --- РАБОТАЕТ
-unsigned char* base64_decode(const unsigned char* input, size_t len, size_t* output_len){
+// Функция декодирования base32 в буфер вызывающего
+size_t base32_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
 /**
- * @brief Декодирует данные из формата Base64
+ * @brief Декодирует данные из Base32 без выделения памяти
  * 
- * @param input Указатель на входные данные в Base64
+ * @param input Указатель на входные данные в Base32
  * @param len Длина входных данных
- * @param output_len Указатель для записи длины выходных данных
- * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * @param output Буфер для результата
+ * @param cap Размер буфера (не меньше base32_decoded_max_len(len): векторные ядра
+ *            пишут блоками и могут занять место под ещё не декодированные группы)
+ * @return size_t Количество записанных байтов или BASE_ERROR (недопустимый символ, буфер мал)
  * 
- * @note Автоматически обрабатывает дополнение '='
- * @warning Выделяет память, которую нужно освободить через free()
+ * @note Автоматически обрабатывает дополнение '=' (недостающие символы последней группы
+ *       считаются дополнением)
+ * @note Полные группы проверяются и декодируются векторным ядром (AVX-512 VBMI, AVX2 или SSSE3),
+ *       скалярный цикл обрабатывает хвост, дополнение и сообщает об ошибках
  */
-    size_t padded_len = len;
-    while (padded_len % 4 != 0) {
-        padded_len++; // Учитываем недостающие символы
+    if (cap < base32_decoded_max_len(len)) {
+        return BASE_ERROR;
     }
 
-    char* padded_input = (char*)malloc(padded_len + 1);
-    if (!padded_input) {
-        fprintf(stderr, "Error: Memory allocation failed.\n");
-        return NULL;
-    }
-    
-    strncpy(padded_input, input, len);
-    memset(padded_input + len, '=', padded_len - len);
-    padded_input[padded_len] = '\0';
-    
-    size_t estimated_size = (padded_len / 4) * 3;
-    unsigned char* output = (unsigned char*)malloc(estimated_size);
-    if (!output) {
-        fprintf(stderr, "Error: Memory allocation failed.\n");
-        free(padded_input);
-        return NULL;
+    size_t i = 0;
+    size_t output_pos = 0;
+
+    const decode_kernels* kernels = decode_dispatch();
+    if (kernels->base32) {
+        i = kernels->base32(input, len, output);
+        output_pos = i / 8 * 5;
     }
 
-    size_t output_pos = 0;
-    for (size_t i = 0; i < padded_len; i += 4) {
-        int indices[4] = {0};
-        for (int j = 0; j < 4; j++) {
-            if (padded_input[i + j] == '=') {
-                indices[j] = 0;
+    // Количество байтов группы по числу символов до первого '=' (не меньше одного байта)
+    static const unsigned char quantum_bytes[9] = {1, 1, 1, 2, 2, 3, 3, 4, 5};
+
+    for (; i < len; i += 8) {
+        uint64_t value = 0;
+        int data_chars = 8;
+        for (int j = 0; j < 8; j++) {
+            // Символы за концом входа считаются дополнением
+            unsigned char c = (i + j < len) ? input[i + j] : '=';
+            unsigned char index = 0;
+            if (c == '=') {
+                if (data_chars == 8) {
+                    data_chars = j;
+                }
             } else {
-                indices[j] = find_index(padded_input[i + j], base64_table);
-                if (indices[j] == -1) {
-                    fprintf(stderr, "Error: Invalid character in input string.\n");
-                    free(output);
-                    free(padded_input);
-                    return NULL;
+                index = base32_rev_table[c];
+                if (index == BASE_INVALID) {
+                    return BASE_ERROR;
                 }
             }
+            value |= (uint64_t)index << (35 - j * 5);
         }
 
-        uint32_t value = 0;
-        for (int j = 0; j < 4; j++) {
-            value |= ((uint32_t)indices[j] << (18 - j * 6));
-        }
-
-        output[output_pos++] = (value >> 16) & 0xFF;
-        if (padded_input[i + 2] != '=') {
-            output[output_pos++] = (value >> 8) & 0xFF;
-        }
-        if (padded_input[i + 3] != '=') {
-            output[output_pos++] = value & 0xFF;
+        for (int k = 0; k < quantum_bytes[data_chars]; k++) {
+            output[output_pos++] = (value >> (32 - 8 * k)) & 0xFF;
         }
-
     }
-    
-    free(padded_input);
-    *output_len = output_pos;
-    return output;
+
+    return output_pos;
 }
 
 
 
-// Функция декодирования исходного файла base85 - алгоритмом --- РАБОТАЕТ
-unsigned char* base85_decode(const unsigned char* input, size_t len, size_t* output_len) {
+// Функция декодирования исходного файла base32 - алгоритмом --- РАБОТАЕТ
+unsigned char* base32_decode(const unsigned char* input, size_t len, size_t* output_len) {
 /**
- * @brief Декодирует данные из формата Base85 (используется в PDF/PostScript)
+ * @brief Декодирует данные из формата Base32
  * 
- * @param input Указатель на входные данные в Base85
+ * @param input Указатель на входные данные в Base32
  * @param len Длина входных данных
  * @param output_len Указатель для записи длины выходных данных
  * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
  * 
- * @note Автоматически пропускает пробелы и символы новой строки
+ * @note Выделяет base32_decoded_max_len(len) + 1 байт и декодирует через base32_decode_into
  * @warning Выделяет память, которую нужно освободить через free()
  */
-    if (!input|| len == 0) {
-        *output_len = 0;
+    size_t estimated_size = base32_decoded_max_len(len);
+    unsigned char* output = (unsigned char*)malloc(estimated_size + 1);
+    if (!output) {
+        fprintf(stderr, "Error: Memory allocation failed.\n");
+        return NULL;
+    }
+
+    size_t output_pos = base32_decode_into(input, len, output, estimated_size);
+    if (output_pos == BASE_ERROR) {
+        // Буфер достаточен, поэтому ошибка - недопустимый символ входа
+        fprintf(stderr, "Error: Invalid character in input string.\n");
+        free(output);
         return NULL;
     }
 
-    // Удаляем возможные пробелы и символы новой строки
-    unsigned char* cleaned_input = (unsigned char*)malloc(len + 1);
-    size_t cleaned_len = 0;
+    *output_len = output_pos;
+    return output;
+}
+
+
+
+// Функция перевода цифр системы счисления radix в байты в буфер вызывающего
+static size_t radix_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                                uint32_t radix, const unsigned char* rev_table, size_t zeros, size_t min_len,
+                                thread_pool* pool) {
+/**
+ * @brief Общая часть base58_decode_into и base62_decode_into
+ * 
+ * @param zeros Число нулевых байтов перед значением (ведущие '1' в Base58)
+ * @param min_len Наименьшая длина записи значения: нулевое число даёт min_len нулевых байтов
+ * @param pool Пул потоков для рекурсивного перевода (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ * 
+ * @note Двоичные слова лежат на стеке, пока их не больше RADIX_STACK_LIMBS; длинные входы
+ *       переводятся во временном буфере в куче
+ */
+    // Проверка символов до начала вычислений
     for (size_t i = 0; i < len; i++) {
-        if (input[i] != ' ' && input[i] != '\n' && input[i] != '\r' && input[i] != '\t') {
-            cleaned_input[cleaned_len++] = input[i];
+        if (rev_table[input[i]] == BASE_INVALID) {
+            return BASE_ERROR;
+        }
+    }
+
+    uint32_t stack_limbs[RADIX_STACK_LIMBS];
+
+    // Двоичные слова: не больше 0.187 слова на символ Base58/Base62
+    size_t limbs_size = len * 19 / 100 + 2;
+    uint32_t* limbs = stack_limbs;
+    if (limbs_size > RADIX_STACK_LIMBS) {
+        limbs = (uint32_t*)malloc(limbs_size * sizeof(uint32_t));
+        if (!limbs) {
+            return BASE_ERROR;
         }
     }
-    cleaned_input[cleaned_len] = '\0';
 
-    // Проверяем, что длина входных данных кратна 5
-    if (cleaned_len % 5 != 0) {
-        free(cleaned_input);
+    size_t result = BASE_ERROR;
+    size_t count = radix_from_chars_parallel(input, len, rev_table, radix, limbs, pool);
+    if (count != RADIX_ERROR) {
+        // Точная длина известна до записи байтов: буфер проверяется без лишнего запаса
+        size_t bytes = radix_limbs_bytes_len(limbs, count);
+        size_t pad = bytes < min_len ? min_len - bytes : 0;
+        if (zeros + pad + bytes <= cap) {
+            memset(output, 0, zeros + pad);
+            radix_limbs_to_bytes(limbs, count, output + zeros + pad);
+            result = zeros + pad + bytes;
+        }
+    }
+
+    if (limbs != stack_limbs) {
+        free(limbs);
+    }
+    return result;
+}
+
+
+
+// Функция наибольшей длины результата декодирования base58
+size_t base58_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает наибольшую длину результата декодирования len символов Base58
+ * 
+ * @note Каждая ведущая '1' даёт байт, остальные цифры - не больше 0.733 байта на символ,
+ *       поэтому результат никогда не длиннее входа
+ */
+    return len;
+}
+
+
+
+// Функция декодирования base58 в буфер вызывающего
+size_t base58_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует данные из Base58 без выделения памяти под результат
+ * 
+ * @param input Указатель на входные данные в Base58
+ * @param len Длина входных данных
+ * @param output Буфер для результата
+ * @param cap Размер буфера: base58_decoded_max_len(len) достаточно всегда, но проверяется
+ *            точная длина результата
+ * @return size_t Количество записанных байтов или BASE_ERROR (недопустимый символ,
+ *         буфер мал, нет памяти)
+ * 
+ * @note Корректно обрабатывает ведущие '1' (кодируют нулевые байты)
+ * @note Цифры вносятся в 32-битные слова группами по 5 (одно умножение на 58^5);
+ *       входы короче ~5.3 КБ переводятся без обращения к куче (см. RADIX_STACK_LIMBS)
+ */
+    size_t zero_count = 0;
+    while (zero_count < len && input[zero_count] == base58_table[0]) {
+        zero_count++;
+    }
+    return radix_decode_into(input + zero_count, len - zero_count, output, cap,
+                             58, base58_rev_table, zero_count, 0, NULL);
+}
+
+
+
+// Функция декодирования исходного файла base58 - алгоритмом --- РАБОТАЕТ
+unsigned char* base58_decode(const unsigned char* input, size_t len, size_t* output_len) {
+/**
+ * @brief Декодирует данные из формата Base58 (используется в Bitcoin)
+ * 
+ * @param input Указатель на входные данные в Base58
+ * @param len Длина входных данных
+ * @param output_len Указатель для записи длины выходных данных
+ * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @note Декодирует через base58_decode_into в буфер по верхней оценке длины
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    size_t capacity = base58_decoded_max_len(len);
+    unsigned char* output = (unsigned char*)malloc(capacity + 1);
+    if (!output) {
+        *output_len = 0;
+        return NULL;
+    }
+
+    size_t output_size = base58_decode_into(input, len, output, capacity);
+    if (output_size == BASE_ERROR) {
+        free(output);
         *output_len = 0;
         return NULL;
     }
 
-    // Вычисляем длину выходных данных
-    *output_len = (cleaned_len / 5) * 4;
-    unsigned char* output = (unsigned char*)malloc(*output_len);
-    if (!output) {
-        free(cleaned_input);
+    output[output_size] = '\0';
+    *output_len = output_size;
+    return output;
+}
+
+
+
+// Функция наибольшей длины результата декодирования base62
+size_t base62_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает наибольшую длину результата декодирования len символов Base62
+ * 
+ * @note log256(62) < 0.75 байта на символ; нулевое значение даёт один байт
+ */
+    return len * 75 / 100 + 1;
+}
+
+
+
+// Функция декодирования base62 в буфер вызывающего
+size_t base62_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует данные из Base62 без выделения памяти под результат
+ * 
+ * @param input Указатель на входные данные в Base62
+ * @param len Длина входных данных (пустой вход - ошибка)
+ * @param output Буфер для результата
+ * @param cap Размер буфера: base62_decoded_max_len(len) достаточно всегда, но проверяется
+ *            точная длина результата
+ * @return size_t Количество записанных байтов или BASE_ERROR (недопустимый символ,
+ *         буфер мал, нет памяти)
+ * 
+ * @note Нулевое значение декодируется в один нулевой байт
+ * @note Входы короче ~5.3 КБ переводятся без обращения к куче (см. RADIX_STACK_LIMBS)
+ */
+    if (len == 0) {
+        return BASE_ERROR;
+    }
+    return radix_decode_into(input, len, output, cap, 62, base62_rev_table, 0, 1, NULL);
+}
+
+
+
+// Функция декодирования исходного файла base62 - алгоритмом --- РАБОТАЕТ
+unsigned char* base62_decode(const unsigned char* input, size_t len, size_t* output_len) {
+/**
+ * @brief Декодирует данные из формата Base62 (0-9, A-Z, a-z)
+ * 
+ * @param input Указатель на входные данные в Base62
+ * @param len Длина входных данных
+ * @param output_len Указатель для записи длины выходных данных
+ * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @note Декодирует через base62_decode_into в буфер по верхней оценке длины
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    if (len == 0) {
         *output_len = 0;
         return NULL;
     }
 
-    // Декодирование
-    size_t output_index = 0;
-    for (size_t i = 0; i < cleaned_len; i += 5) {
-        unsigned long value = 0;
-        for (int j = 0; j < 5; j++) {
-            const char* pos = strchr(base85_table, cleaned_input[i + j]);
-            if (pos == NULL) {
-                free(cleaned_input);
-                free(output);
-                *output_len = 0;
-                return NULL;
-            }
-            value = value * 85 + (pos - base85_table);
+    size_t capacity = base62_decoded_max_len(len);
+    unsigned char* result = (unsigned char*)malloc(capacity + 1);
+    if (!result) {
+        *output_len = 0;
+        return NULL;
+    }
+
+    size_t result_len = base62_decode_into(input, len, result, capacity);
+    if (result_len == BASE_ERROR) {
+        free(result);
+        *output_len = 0;
+        return NULL;
+    }
+
+    result[result_len] = '\0';
+    *output_len = result_len;
+    return result;
+}
+
+
+
+// Функция длины блока по ширине последней группы цифр
+static size_t radix_blocked_tail_len(size_t tail_width, uint32_t radix) {
+/**
+ * @return size_t Длина неполного блока или RADIX_BLOCK_BYTES, если такой ширины не бывает
+ */
+    size_t tail_len = 0;
+    if (tail_width) {
+        while (tail_len < RADIX_BLOCK_BYTES && radix_block_width(tail_len, radix) != tail_width) {
+            tail_len++;
+        }
+    }
+    return tail_len;
+}
+
+
+
+// Функция наибольшей длины результата блочного декодирования
+static size_t radix_blocked_decoded_max_len(size_t len, uint32_t radix) {
+    size_t full_width = radix_block_width(RADIX_BLOCK_BYTES, radix);
+    size_t tail_len = radix_blocked_tail_len(len % full_width, radix);
+    return len / full_width * RADIX_BLOCK_BYTES + (tail_len < RADIX_BLOCK_BYTES ? tail_len : 0);
+}
+
+
+
+// Функция блочного декодирования из системы счисления radix
+static size_t radix_blocked_decode(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                                   uint32_t radix, const unsigned char* rev_table) {
+/**
+ * @brief Декодирует группы цифр фиксированной ширины обратно в блоки по RADIX_BLOCK_BYTES байтов
+ * 
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ * 
+ * @note Длина последнего неполного блока определяется по ширине последней группы; ширина,
+ *       не соответствующая ни одной длине блока, и значение группы, не помещающееся в блок,
+ *       считаются ошибкой
+ */
+    for (size_t i = 0; i < len; i++) {
+        if (rev_table[input[i]] == BASE_INVALID) {
+            return BASE_ERROR;
         }
+    }
+
+    size_t full_width = radix_block_width(RADIX_BLOCK_BYTES, radix);
+    size_t full_blocks = len / full_width;
+    size_t tail_width = len % full_width;
+    size_t tail_len = radix_blocked_tail_len(tail_width, radix);
+    if (tail_len == RADIX_BLOCK_BYTES) {
+        return BASE_ERROR;
+    }
+    if (cap < full_blocks * RADIX_BLOCK_BYTES + tail_len) {
+        return BASE_ERROR;
+    }
+
+    for (size_t b = 0; b < full_blocks; b++) {
+        if (radix_block_from_chars(input + b * full_width, full_width, rev_table, radix,
+                                   output + b * RADIX_BLOCK_BYTES, RADIX_BLOCK_BYTES) != 0) {
+            return BASE_ERROR;
+        }
+    }
+    if (tail_width && radix_block_from_chars(input + full_blocks * full_width, tail_width, rev_table, radix,
+                                             output + full_blocks * RADIX_BLOCK_BYTES, tail_len) != 0) {
+        return BASE_ERROR;
+    }
+
+    return full_blocks * RADIX_BLOCK_BYTES + tail_len;
+}
+
+
+
+// Функция блочного декодирования с выделением буфера под результат
+static unsigned char* radix_blocked_decode_alloc(const unsigned char* input, size_t len, size_t* output_len,
+                                                 uint32_t radix, const unsigned char* rev_table) {
+    *output_len = 0;
+    size_t capacity = radix_blocked_decoded_max_len(len, radix);
+    unsigned char* output = (unsigned char*)malloc(capacity + 1);
+    if (!output) {
+        return NULL;
+    }
 
-        // Распаковка 32-битного значения в 4 байта
-        output[output_index++] = (value >> 24) & 0xFF;
-        output[output_index++] = (value >> 16) & 0xFF;
-        output[output_index++] = (value >> 8) & 0xFF;
-        output[output_index++] = value & 0xFF;
+    size_t output_size = radix_blocked_decode(input, len, output, capacity, radix, rev_table);
+    if (output_size == BASE_ERROR) {
+        free(output);
+        return NULL;
     }
-    output[output_index++] = '\0';
-    free(cleaned_input);
+
+    *output_len = output_size;
+    output[output_size] = '\0';
     return output;
-}
\ No newline at end of file
+}
+
+
+
+// Функция наибольшей длины результата блочного декодирования base58
+size_t base58_blocked_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает длину результата base58_decode_blocked для входа из len символов
+ *        (точную для корректного входа)
+ */
+    return radix_blocked_decoded_max_len(len, 58);
+}
+
+
+
+// Функция блочного декодирования base58 в буфер вызывающего
+size_t base58_decode_blocked_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует блочный Base58 без выделения памяти
+ * 
+ * @param cap Размер буфера (не меньше base58_blocked_decoded_max_len(len))
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ */
+    return radix_blocked_decode(input, len, output, cap, 58, base58_rev_table);
+}
+
+
+
+// Функция блочного декодирования исходного файла base58 - алгоритмом
+unsigned char* base58_decode_blocked(const unsigned char* input, size_t len, size_t* output_len) {
+/**
+ * @brief Декодирует данные, закодированные base58_encode_blocked
+ * 
+ * @param input Указатель на входные данные (группы по 44 символа Base58)
+ * @param len Длина входных данных
+ * @param output_len Указатель для записи длины выходных данных
+ * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    return radix_blocked_decode_alloc(input, len, output_len, 58, base58_rev_table);
+}
+
+
+
+// Функция наибольшей длины результата блочного декодирования base62
+size_t base62_blocked_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает длину результата base62_decode_blocked для входа из len символов
+ *        (точную для корректного входа)
+ */
+    return radix_blocked_decoded_max_len(len, 62);
+}
+
+
+
+// Функция блочного декодирования base62 в буфер вызывающего
+size_t base62_decode_blocked_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует блочный Base62 без выделения памяти
+ * 
+ * @param cap Размер буфера (не меньше base62_blocked_decoded_max_len(len))
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ */
+    return radix_blocked_decode(input, len, output, cap, 62, base62_rev_table);
+}
+
+
+
+// Функция блочного декодирования исходного файла base62 - алгоритмом
+unsigned char* base62_decode_blocked(const unsigned char* input, size_t len, size_t* output_len) {
+/**
+ * @brief Декодирует данные, закодированные base62_encode_blocked
+ * 
+ * @param input Указатель на входные данные (группы по 43 символа Base62)
+ * @param len Длина входных данных
+ * @param output_len Указатель для записи длины выходных данных
+ * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    return radix_blocked_decode_alloc(input, len, output_len, 62, base62_rev_table);
+}
+
+
+
+// Функция декодирования блоками по 8 символов (SWAR)
+static size_t base64_decode_swar(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 8 символов Base64 в 6 байт одним 64-битным словом
+ * 
+ * @return size_t Количество обработанных символов (кратно 8)
+ * 
+ * @note Значения из base64_rev_table собираются в слово, и BASE_INVALID обнаруживается
+ *       одной проверкой старших битов; на блоке с недопустимым символом (в том числе '=')
+ *       ядро останавливается
+ */
+    size_t i = 0, o = 0;
+    for (; len - i >= 8; i += 8, o += 6) {
+        uint64_t x = 0;
+        for (int k = 0; k < 8; k++) {
+            x = (x << 8) | base64_rev_table[input[i + k]];
+        }
+        if (x & SWAR_HIGH) {
+            break;
+        }
+
+        // 6-битные значения сдвигаются вплотную: 8 байтов -> 48 бит
+        x = (x & 0x003F003F003F003FULL) | ((x & 0x3F003F003F003F00ULL) >> 2);
+        x = (x & 0x00000FFF00000FFFULL) | ((x & 0x0FFF00000FFF0000ULL) >> 4);
+        x = (x & 0x0000000000FFFFFFULL) | ((x & 0x00FFFFFF00000000ULL) >> 8);
+        swar_store_be(output + o, x, 6);
+    }
+    return i;
+}
+
+
+
+#ifdef CPU_ARM64
+// Функция декодирования блоками по 64 символа (NEON)
+static size_t base64_decode_neon(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 64 символа Base64 в 48 байт за итерацию
+ * 
+ * @return size_t Количество обработанных символов (кратно 64)
+ * 
+ * @note vld4 раскладывает символы групп по четырём регистрам, значения берутся из
+ *       base64_rev_table (tbl/tbx по первым 128 кодам), vst3 собирает байты обратно
+ * @note На блоке с недопустимым символом (в том числе '=') ядро останавливается
+ */
+    uint8x16x4_t rev_lo, rev_hi;
+    for (int k = 0; k < 4; k++) {
+        rev_lo.val[k] = vld1q_u8(base64_rev_table + 16 * k);
+        rev_hi.val[k] = vld1q_u8(base64_rev_table + 64 + 16 * k);
+    }
+    size_t i = 0, o = 0;
+
+    for (; len - i >= 64; i += 64, o += 48) {
+        const uint8x16x4_t in = vld4q_u8(input + i);
+        uint8x16_t v[4];
+        uint8x16_t invalid = vdupq_n_u8(0);
+        for (int k = 0; k < 4; k++) {
+            v[k] = vqtbx4q_u8(vqtbl4q_u8(rev_lo, in.val[k]), rev_hi, vsubq_u8(in.val[k], vdupq_n_u8(64)));
+            invalid = vorrq_u8(invalid, vorrq_u8(v[k], in.val[k]));
+        }
+        if (vmaxvq_u8(invalid) & 0x80) {
+            break;
+        }
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(v[0], 2), vshrq_n_u8(v[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(v[1], 4), vshrq_n_u8(v[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(v[2], 6), v[3]);
+        vst3q_u8(output + o, bytes);
+    }
+    return i;
+}
+#endif
+
+
+
+#ifdef CPU_X86
+// Функция декодирования блоками по 32 символа (AVX2)
+__attribute__((target("avx2")))
+static size_t base64_decode_avx2(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 32 символа Base64 в 24 байта за итерацию
+ * 
+ * @param input Входные символы Base64
+ * @param len Количество символов
+ * @param output Буфер результата (не меньше 3/4 от len)
+ * @return size_t Количество обработанных символов (кратно 32)
+ * 
+ * @note Останавливается на первом блоке с символом вне алфавита (в том числе '='):
+ *       такой блок, дополнение и ошибки обрабатывает скалярный код
+ * @note Записывает по 32 байта, поэтому оставляет скалярному коду не меньше 44 символов
+ */
+    // Проверка символа: класс по младшему полубайту & класс по старшему полубайту == 0
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    // Смещение от ASCII-кода к значению для каждого диапазона алфавита
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask_2f = _mm256_set1_epi8(0x2F);
+    // Сборка 3 байтов из младших 24 бит каждого 32-битного слова
+    const __m256i pack = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+    size_t i = 0, o = 0;
+    for (; len - i >= 44; i += 32, o += 24) {
+        __m256i in = _mm256_loadu_si256((const __m256i*)(input + i));
+
+        const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+        const __m256i lo_nibbles = _mm256_and_si256(in, mask_2f);
+        const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+        const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        if (!_mm256_testz_si256(lo, hi)) {
+            break;
+        }
+
+        // '/' единственный символ своего диапазона, который нельзя отличить по старшему полубайту
+        const __m256i eq_2f = _mm256_cmpeq_epi8(in, mask_2f);
+        const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2f, hi_nibbles));
+        in = _mm256_add_epi8(in, roll);
+
+        // 4 шестибитных значения -> 24-битное слово
+        const __m256i merge_ab_bc = _mm256_maddubs_epi16(in, _mm256_set1_epi32(0x01400140));
+        const __m256i merged = _mm256_madd_epi16(merge_ab_bc, _mm256_set1_epi32(0x00011000));
+
+        __m256i packed = _mm256_shuffle_epi8(merged, pack);
+        packed = _mm256_permutevar8x32_epi32(packed, join);
+        _mm256_storeu_si256((__m256i*)(output + o), packed);
+    }
+    return i;
+}
+
+
+
+// Функция декодирования блоками по 64 символа (AVX-512 VBMI)
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static size_t base64_decode_vbmi(const unsigned char* input, size_t len, unsigned char* output) {
+/**
+ * @brief Проверяет и декодирует 64 символа Base64 в 48 байт за итерацию
+ * 
+ * @return size_t Количество обработанных символов (кратно 4)
+ * 
+ * @note Символы переводятся в значения по base64_rev_table через vpermi2b (первые 128 кодов);
+ *       символ вне алфавита или с установленным старшим битом даёт байт со старшим битом
+ * @note Декодирует все полные группы до первого недопустимого символа (в том числе '=')
+ *       и останавливается; хвост загружается и записывается по маске
+ */
+    const __m512i lookup_lo = _mm512_loadu_si512((const void*)base64_rev_table);
+    const __m512i lookup_hi = _mm512_loadu_si512((const void*)(base64_rev_table + 64));
+    // Сборка 3 байтов из младших 24 бит каждого 32-битного слова
+    const __m512i pack = _mm512_setr_epi32(
+        0x06000102, 0x090A0405, 0x0C0D0E08, 0x16101112, 0x191A1415, 0x1C1D1E18, 0x26202122, 0x292A2425,
+        0x2C2D2E28, 0x36303132, 0x393A3435, 0x3C3D3E38, 0, 0, 0, 0);
+    size_t i = 0, o = 0;
+
+    while (len - i >= 4) {
+        size_t n = (len - i >= 64) ? 64 : (len - i) & ~(size_t)3;
+        const __mmask64 in_mask = (n == 64) ? ~(__mmask64)0 : ((__mmask64)1 << n) - 1;
+        const __m512i in = _mm512_maskz_loadu_epi8(in_mask, input + i);
+        const __m512i values = _mm512_permutex2var_epi8(lookup_lo, in, lookup_hi);
+
+        const __mmask64 bad = _mm512_movepi8_mask(_mm512_or_si512(values, in)) & in_mask;
+        if (bad) {
+            n = (size_t)__builtin_ctzll(bad) & ~(size_t)3;
+        }
+
+        // 4 шестибитных значения -> 24-битное слово
+        const __m512i merge_ab_bc = _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+        const __m512i merged = _mm512_madd_epi16(merge_ab_bc, _mm512_set1_epi32(0x00011000));
+
+        const __mmask64 out_mask = ((__mmask64)1 << (n / 4 * 3)) - 1;
+        _mm512_mask_storeu_epi8(output + o, out_mask, _mm512_permutexvar_epi8(pack, merged));
+        i += n;
+        o += n / 4 * 3;
+        if (bad) {
+            break;
+        }
+    }
+    return i;
+}
+#endif
+
+
+
+// Функция наибольшей длины результата декодирования base64
+size_t base64_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает наибольшую длину результата декодирования len символов Base64
+ * 
+ * @note Дополнение '=' уменьшает результат на 1-2 байта
+ */
+    return ((len + 3) / 4) * 3;
+}
+
+
+
+// Функция декодирования base64 в буфер вызывающего
+size_t base64_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует данные из Base64 без выделения памяти
+ * 
+ * @param input Указатель на входные данные в Base64
+ * @param len Длина входных данных
+ * @param output Буфер для результата
+ * @param cap Размер буфера (не меньше base64_decoded_max_len(len): векторные ядра
+ *            пишут блоками и могут занять место под ещё не декодированные группы)
+ * @return size_t Количество записанных байтов или BASE_ERROR (недопустимый символ, буфер мал)
+ * 
+ * @note Автоматически обрабатывает дополнение '=' (недостающие символы последней группы
+ *       считаются дополнением)
+ * @note При поддержке AVX-512 VBMI или AVX2 основная часть проверяется и декодируется векторно,
+ *       скалярный цикл обрабатывает хвост, дополнение и сообщает об ошибках
+ */
+    if (cap < base64_decoded_max_len(len)) {
+        return BASE_ERROR;
+    }
+
+    size_t i = 0;
+    size_t output_pos = 0;
+
+    const decode_kernels* kernels = decode_dispatch();
+    if (kernels->base64) {
+        i = kernels->base64(input, len, output);
+        output_pos = i / 4 * 3;
+    }
+
+    for (; i < len; i += 4) {
+        unsigned char quantum[4];
+        int indices[4] = {0};
+        for (int j = 0; j < 4; j++) {
+            // Символы за концом входа считаются дополнением
+            quantum[j] = (i + j < len) ? input[i + j] : '=';
+            if (quantum[j] == '=') {
+                indices[j] = 0;
+            } else {
+                indices[j] = base64_rev_table[quantum[j]];
+                if (indices[j] == BASE_INVALID) {
+                    return BASE_ERROR;
+                }
+            }
+        }
+
+        uint32_t value = 0;
+        for (int j = 0; j < 4; j++) {
+            value |= ((uint32_t)indices[j] << (18 - j * 6));
+        }
+
+        output[output_pos++] = (value >> 16) & 0xFF;
+        if (quantum[2] != '=') {
+            output[output_pos++] = (value >> 8) & 0xFF;
+        }
+        if (quantum[3] != '=') {
+            output[output_pos++] = value & 0xFF;
+        }
+
+    }
+
+    return output_pos;
+}
+
+
+
+// Функция декодирования исходного файла base64 - алгоритмом --- РАБОТАЕТ
+unsigned char* base64_decode(const unsigned char* input, size_t len, size_t* output_len){
+/**
+ * @brief Декодирует данные из формата Base64
+ * 
+ * @param input Указатель на входные данные в Base64
+ * @param len Длина входных данных
+ * @param output_len Указатель для записи длины выходных данных
+ * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @note Выделяет base64_decoded_max_len(len) + 1 байт и декодирует через base64_decode_into
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    size_t estimated_size = base64_decoded_max_len(len);
+    unsigned char* output = (unsigned char*)malloc(estimated_size + 1);
+    if (!output) {
+        fprintf(stderr, "Error: Memory allocation failed.\n");
+        return NULL;
+    }
+
+    size_t output_pos = base64_decode_into(input, len, output, estimated_size);
+    if (output_pos == BASE_ERROR) {
+        // Буфер достаточен, поэтому ошибка - недопустимый символ входа
+        fprintf(stderr, "Error: Invalid character in input string.\n");
+        free(output);
+        return NULL;
+    }
+
+    *output_len = output_pos;
+    return output;
+}
+
+
+
+#ifdef CPU_X86
+// Функция декодирования блоками по 40 символов (AVX2)
+__attribute__((target("avx2")))
+static size_t base85_decode_avx2(const unsigned char* input, size_t len, unsigned char* output, int strict) {
+/**
+ * @brief Проверяет и декодирует 8 групп по 5 символов Base85 в 32 байта за итерацию
+ * 
+ * @param strict Ненулевое значение - останавливаться на группе со значением больше 2^32 - 1
+ *               (Ascii85 считает её ошибкой, а Base85 берёт значение по модулю 2^32)
+ * @return size_t Количество обработанных символов (кратно 40)
+ * 
+ * @note Останавливается на первом блоке с пробельным символом или символом вне '!'..'u':
+ *       такой блок обрабатывает скалярный код
+ * @note Каждая половина регистра получает 4 группы (20 символов) двумя загрузками со
+ *       сдвигом 4: X - символы 0-15, Z - символы 4-19. Схема Горнера: pmaddubsw (85, 1)
+ *       даёт d0*85+d1 и d2*85+d3, pmaddwd (7225, 1) - d0..d3, затем *85 + d4 по модулю 2^32
+ */
+    // Символы 0-3 групп 0-2 из X, группы 3 из Z, пятый символ каждой группы из Z
+    const __m256i head_x = _mm256_setr_epi8(
+        0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12, 13, -1, -1, -1, -1,
+        0, 1, 2, 3, 5, 6, 7, 8, 10, 11, 12, 13, -1, -1, -1, -1);
+    const __m256i head_z = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, 12, 13, 14,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, 12, 13, 14);
+    const __m256i tail_z = _mm256_setr_epi8(
+        0, -1, -1, -1, 5, -1, -1, -1, 10, -1, -1, -1, 15, -1, -1, -1,
+        0, -1, -1, -1, 5, -1, -1, -1, 10, -1, -1, -1, 15, -1, -1, -1);
+    const __m256i bswap = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    const __m256i below = _mm256_set1_epi8('!' - 1);
+    const __m256i above = _mm256_set1_epi8('u' + 1);
+    const __m256i first_char = _mm256_set1_epi8('!');
+    size_t i = 0, o = 0;
+
+    for (; len - i >= 40; i += 40, o += 32) {
+        const __m256i x = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(input + i))),
+            _mm_loadu_si128((const __m128i*)(input + i + 20)), 1);
+        const __m256i z = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(input + i + 4))),
+            _mm_loadu_si128((const __m128i*)(input + i + 24)), 1);
+
+        const __m256i valid = _mm256_and_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi8(x, below), _mm256_cmpgt_epi8(above, x)),
+            _mm256_and_si256(_mm256_cmpgt_epi8(z, below), _mm256_cmpgt_epi8(above, z)));
+        if (_mm256_movemask_epi8(valid) != -1) {
+            break;
+        }
+        const __m256i dx = _mm256_sub_epi8(x, first_char);
+        const __m256i dz = _mm256_sub_epi8(z, first_char);
+
+        const __m256i head = _mm256_or_si256(_mm256_shuffle_epi8(dx, head_x), _mm256_shuffle_epi8(dz, head_z));
+        const __m256i pairs = _mm256_maddubs_epi16(head, _mm256_set1_epi16(0x0155));
+        const __m256i quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011C39));
+        const __m256i last = _mm256_shuffle_epi8(dz, tail_z);
+        const __m256i value = _mm256_add_epi32(_mm256_mullo_epi32(quads, _mm256_set1_epi32(85)), last);
+
+        if (strict) {
+            // 85 * 50529027 = 2^32 - 1: переполнение при большем d0..d3 или при равном и d4 > 0
+            const __m256i limit = _mm256_set1_epi32(50529027);
+            const __m256i overflow = _mm256_or_si256(
+                _mm256_cmpgt_epi32(quads, limit),
+                _mm256_and_si256(_mm256_cmpeq_epi32(quads, limit), _mm256_cmpgt_epi32(last, _mm256_setzero_si256())));
+            if (!_mm256_testz_si256(overflow, overflow)) {
+                break;
+            }
+        }
+
+        _mm256_storeu_si256((__m256i*)(output + o), _mm256_shuffle_epi8(value, bswap));
+    }
+    return i;
+}
+#endif
+
+
+
+// Функция наибольшей длины результата декодирования base85
+size_t base85_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает наибольшую длину результата декодирования len символов Base85
+ * 
+ * @note Пробельные символы только уменьшают результат
+ */
+    return (len / 5) * 4;
+}
+
+
+
+// Функция декодирования base85 в буфер вызывающего
+size_t base85_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует данные из Base85 без выделения памяти
+ * 
+ * @param input Указатель на входные данные в Base85
+ * @param len Длина входных данных
+ * @param output Буфер для результата
+ * @param cap Размер буфера: base85_decoded_max_len(len) достаточно всегда, для входа с
+ *            пробелами хватает и меньшего (место проверяется по ходу)
+ * @return size_t Количество записанных байтов или BASE_ERROR (недопустимый символ,
+ *         незавершённая группа, буфер мал)
+ * 
+ * @note Пробелы и символы новой строки пропускаются на лету, без копии входа
+ * @note Значение группы берётся по модулю 2^32 (группы больше "s8W-!" переполняются)
+ * @note При поддержке AVX2 участки без пробелов декодируются по 8 групп за итерацию,
+ *       после каждой группы, собранной скалярно, векторное ядро запускается снова
+ */
+    size_t output_index = 0;
+    size_t i = 0;
+    uint32_t value = 0;
+    int digits = 0;
+
+    const decode_kernels* kernels = decode_dispatch();
+
+    while (i < len) {
+        if (kernels->base85 && digits == 0) {
+            // Ядру отдаётся не больше символов, чем поместится в остаток буфера
+            size_t room = (cap - output_index) / 4 * 5;
+            size_t done = kernels->base85(input + i, len - i < room ? len - i : room, output + output_index, 0);
+            i += done;
+            output_index += done / 5 * 4;
+            if (i == len) {
+                break;
+            }
+        }
+        // Одна группа скалярно: пробельные символы пропускаются
+        for (; i < len && digits < 5; i++) {
+            unsigned char c = input[i];
+            if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+                continue;
+            }
+            unsigned char digit = base85_rev_table[c];
+            if (digit == BASE_INVALID) {
+                return BASE_ERROR;
+            }
+            value = value * 85 + digit;
+            digits++;
+        }
+
+        if (digits == 5) {
+            if (cap - output_index < 4) {
+                return BASE_ERROR;
+            }
+            // Распаковка 32-битного значения в 4 байта
+            output[output_index++] = (value >> 24) & 0xFF;
+            output[output_index++] = (value >> 16) & 0xFF;
+            output[output_index++] = (value >> 8) & 0xFF;
+            output[output_index++] = value & 0xFF;
+            value = 0;
+            digits = 0;
+        }
+    }
+
+    // Количество значащих символов должно быть кратно 5
+    if (digits != 0) {
+        return BASE_ERROR;
+    }
+
+    return output_index;
+}
+
+
+
+// Функция декодирования исходного файла base85 - алгоритмом --- РАБОТАЕТ
+unsigned char* base85_decode(const unsigned char* input, size_t len, size_t* output_len) {
+/**
+ * @brief Декодирует данные из формата Base85 (используется в PDF/PostScript)
+ * 
+ * @param input Указатель на входные данные в Base85
+ * @param len Длина входных данных
+ * @param output_len Указатель для записи длины выходных данных
+ * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @note Декодирует через base85_decode_into в буфер по верхней оценке длины
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    if (!input|| len == 0) {
+        *output_len = 0;
+        return NULL;
+    }
+
+    // Верхняя оценка: пробелы только уменьшают результат
+    size_t capacity = base85_decoded_max_len(len);
+    unsigned char* output = (unsigned char*)malloc(capacity + 1);
+    if (!output) {
+        *output_len = 0;
+        return NULL;
+    }
+
+    size_t output_index = base85_decode_into(input, len, output, capacity);
+    if (output_index == BASE_ERROR) {
+        free(output);
+        *output_len = 0;
+        return NULL;
+    }
+
+    output[output_index] = '\0';
+    *output_len = output_index;
+    return output;
+}
+
+
+
+// Функция наибольшей длины результата декодирования ascii85
+size_t ascii85_decoded_max_len(size_t len) {
+/**
+ * @brief Возвращает наибольшую длину результата декодирования len символов Ascii85
+ * 
+ * @note Оценка учитывает худший случай, когда каждый символ - 'z' или 'y' (4 байта);
+ *       ascii85_decode_into проверяет место по ходу, и для входа без сокращений
+ *       достаточно (len / 5) * 4 + 3 байт
+ */
+    return len * 4;
+}
+
+
+
+// Функция декодирования ascii85 в буфер вызывающего
+size_t ascii85_decode_into(const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует данные из формата Ascii85 (Adobe) без выделения памяти
+ * 
+ * @param input Указатель на входные данные в Ascii85
+ * @param len Длина входных данных
+ * @param output Буфер для результата
+ * @param cap Размер буфера (место проверяется по ходу, см. ascii85_decoded_max_len)
+ * @return size_t Количество записанных байтов или BASE_ERROR (некорректный вход, буфер мал)
+ * 
+ * @note Рамка "<~" необязательна, "~>" завершает данные (всё после неё игнорируется).
+ *       'z' (нулевая группа) и 'y' (четыре пробела) допустимы только между группами.
+ *       Неполная последняя группа из k символов (2-4) дополняется 'u' и даёт k - 1 байт.
+ * @note В отличие от base85_decode, группа со значением больше 2^32 - 1 считается ошибкой
+ */
+    size_t i = 0;
+
+    // Необязательное начало рамки после пробельных символов
+    while (i < len && (input[i] == ' ' || input[i] == '\n' || input[i] == '\r' || input[i] == '\t')) {
+        i++;
+    }
+    if (len - i >= 2 && input[i] == '<' && input[i + 1] == '~') {
+        i += 2;
+    }
+
+    size_t output_index = 0;
+    uint64_t value = 0;
+    int digits = 0;
+
+    const decode_kernels* kernels = decode_dispatch();
+
+    while (i < len) {
+        if (kernels->base85 && digits == 0) {
+            // Ядру отдаётся не больше символов, чем поместится в остаток буфера
+            size_t room = (cap - output_index) / 4 * 5;
+            size_t done = kernels->base85(input + i, len - i < room ? len - i : room, output + output_index, 1);
+            i += done;
+            output_index += done / 5 * 4;
+            if (i == len) {
+                break;
+            }
+        }
+        unsigned char c = input[i++];
+        if (c == ' ' || c == '\n' || c == '\r' || c == '\t') {
+            continue;
+        }
+        if (c == '~') {
+            // Конец данных
+            if (i < len && input[i] == '>') {
+                break;
+            }
+            return BASE_ERROR;
+        }
+        if ((c == 'z' || c == 'y') && digits == 0) {
+            if (cap - output_index < 4) {
+                return BASE_ERROR;
+            }
+            memset(output + output_index, c == 'z' ? 0 : ' ', 4);
+            output_index += 4;
+            continue;
+        }
+
+        unsigned char digit = base85_rev_table[c];
+        if (digit == BASE_INVALID) {
+            return BASE_ERROR;
+        }
+        value = value * 85 + digit;
+        if (++digits == 5) {
+            if (value > 0xFFFFFFFFu || cap - output_index < 4) {
+                return BASE_ERROR;
+            }
+            output[output_index++] = (value >> 24) & 0xFF;
+            output[output_index++] = (value >> 16) & 0xFF;
+            output[output_index++] = (value >> 8) & 0xFF;
+            output[output_index++] = value & 0xFF;
+            value = 0;
+            digits = 0;
+        }
+    }
+
+    // Неполная группа: дополняется старшей цифрой 'u', записываются digits - 1 байт
+    if (digits == 1) {
+        return BASE_ERROR;
+    }
+    if (digits > 1) {
+        size_t bytes = (size_t)digits - 1;
+        for (; digits < 5; digits++) {
+            value = value * 85 + 84;
+        }
+        if (value > 0xFFFFFFFFu || cap - output_index < bytes) {
+            return BASE_ERROR;
+        }
+        for (size_t k = 0; k < bytes; k++) {
+            output[output_index++] = (value >> (24 - 8 * k)) & 0xFF;
+        }
+    }
+
+    return output_index;
+}
+
+
+
+// Функция декодирования исходного файла ascii85 - алгоритмом
+unsigned char* ascii85_decode(const unsigned char* input, size_t len, size_t* output_len) {
+/**
+ * @brief Декодирует данные из формата Ascii85 (Adobe)
+ * 
+ * @param input Указатель на входные данные в Ascii85
+ * @param len Длина входных данных
+ * @param output_len Указатель для записи длины выходных данных
+ * @return unsigned char* Указатель на декодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @note Декодирует через ascii85_decode_into; буфер оценивается по числу символов 'z'/'y',
+ *       а не по худшему случаю ascii85_decoded_max_len
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    *output_len = 0;
+
+    // Верхняя оценка: 4 байта на 5 символов и на каждый 'z'/'y', плюс неполная группа
+    size_t runs = 0;
+    for (size_t j = 0; j < len; j++) {
+        runs += (input[j] == 'z' || input[j] == 'y');
+    }
+    size_t capacity = len / 5 * 4 + runs * 4 + 3;
+    unsigned char* output = (unsigned char*)malloc(capacity + 1);
+    if (!output) {
+        return NULL;
+    }
+
+    size_t output_index = ascii85_decode_into(input, len, output, capacity);
+    if (output_index == BASE_ERROR) {
+        free(output);
+        return NULL;
+    }
+
+    output[output_index] = '\0';
+    *output_len = output_index;
+    return output;
+}
+
+
+
+// Параметры кодека для потокового декодирования
+typedef struct {
+    size_t quantum;                  // символов в кванте
+    const unsigned char* rev_table;  // обратная таблица алфавита
+    unsigned char padding;           // символ дополнения ('=') или 0, если его нет
+    size_t (*decode)(const unsigned char* input, size_t len, unsigned char* output, size_t cap);
+    size_t (*decoded_max_len)(size_t len);
+} stream_codec;
+
+static const stream_codec base16_stream = {2, base16_rev_table, 0, base16_decode_into, base16_decoded_max_len};
+static const stream_codec base32_stream = {8, base32_rev_table, '=', base32_decode_into, base32_decoded_max_len};
+static const stream_codec base64_stream = {4, base64_rev_table, '=', base64_decode_into, base64_decoded_max_len};
+static const stream_codec base85_stream = {5, base85_rev_table, 0, base85_decode_into, base85_decoded_max_len};
+
+
+
+// Функция поиска первого недопустимого символа
+static size_t stream_invalid_index(const stream_codec* codec, const unsigned char* chars, size_t len) {
+/**
+ * @brief Находит символ, из-за которого декодер отверг фрагмент
+ * 
+ * @return size_t Индекс символа или 0, если все символы допустимы (ошибка в длине)
+ */
+    for (size_t k = 0; k < len; k++) {
+        if (codec->rev_table[chars[k]] == BASE_INVALID && (codec->padding == 0 || chars[k] != codec->padding)) {
+            return k;
+        }
+    }
+    return 0;
+}
+
+
+
+// Функция фиксации ошибки потокового декодирования
+static size_t stream_fail(base_dec_state* state, uint64_t offset) {
+    state->failed = 1;
+    state->error_offset = offset;
+    return BASE_ERROR;
+}
+
+
+
+// Функция начала потокового декодирования
+static void stream_decode_init(base_dec_state* state) {
+    state->carry_len = 0;
+    state->offset = 0;
+    state->error_offset = 0;
+    state->failed = 0;
+}
+
+
+
+// Функция потокового декодирования очередного фрагмента
+static size_t stream_decode_update(const stream_codec* codec, base_dec_state* state, const unsigned char* input,
+                                   size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Общая часть baseN_dec_update: декодирует все полные кванты фрагмента,
+ *        неполный квант переносит в следующий вызов
+ * 
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ * 
+ * @note Участки без пробельных символов целиком передаются baseN_decode_into (с векторными
+ *       ядрами); посимвольно собирается только квант, разорванный пробелом или границей
+ *       фрагмента. Кванты те же, что при декодировании всего входа без пробелов сразу,
+ *       поэтому и результат совпадает
+ * @note Ошибка запоминается: следующие вызовы сразу возвращают BASE_ERROR
+ */
+    if (state->failed) {
+        return BASE_ERROR;
+    }
+    if (cap < codec->decoded_max_len(state->carry_len + len)) {
+        return BASE_ERROR;
+    }
+
+    const size_t quantum = codec->quantum;
+    size_t written = 0;
+    size_t i = 0;
+
+    while (i < len) {
+        if (state->carry_len == 0) {
+            // Пробельные символы (' ', '\t', '\n', '\r') не больше ' ': одно сравнение на символ
+            size_t j = i;
+            while (j < len && input[j] > ' ') {
+                j++;
+            }
+            size_t full = (j - i) / quantum * quantum;
+            if (full > 0) {
+                size_t n = codec->decode(input + i, full, output + written, cap - written);
+                if (n == BASE_ERROR) {
+                    return stream_fail(state, state->offset + i + stream_invalid_index(codec, input + i, full));
+                }
+                written += n;
+                i += full;
+                continue;
+            }
+        }
+
+        // Квант, разорванный пробелом или границей фрагмента, собирается посимвольно
+        unsigned char c = input[i];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+            state->carry[state->carry_len] = c;
+            state->carry_pos[state->carry_len++] = state->offset + i;
+            if (state->carry_len == quantum) {
+                size_t n = codec->decode(state->carry, quantum, output + written, cap - written);
+                if (n == BASE_ERROR) {
+                    return stream_fail(state, state->carry_pos[stream_invalid_index(codec, state->carry, quantum)]);
+                }
+                written += n;
+                state->carry_len = 0;
+            }
+        }
+        i++;
+    }
+
+    state->offset += len;
+    return written;
+}
+
+
+
+// Функция завершения потокового декодирования
+static size_t stream_decode_final(const stream_codec* codec, base_dec_state* state, unsigned char* output, size_t cap) {
+/**
+ * @brief Общая часть baseN_dec_final: декодирует неполный последний квант как хвост входа
+ * 
+ * @note Для Base32/Base64 недостающие символы считаются дополнением '='; для Base16/Base85
+ *       неполный квант - ошибка с позицией его первого символа
+ */
+    if (state->failed) {
+        return BASE_ERROR;
+    }
+    if (state->carry_len == 0) {
+        return 0;
+    }
+
+    size_t n = codec->decode(state->carry, state->carry_len, output, cap);
+    if (n == BASE_ERROR) {
+        return stream_fail(state, state->carry_pos[stream_invalid_index(codec, state->carry, state->carry_len)]);
+    }
+    state->carry_len = 0;
+    return n;
+}
+
+
+
+// Функция начала потокового декодирования base16
+void base16_dec_init(base_dec_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового декодирования
+ */
+    stream_decode_init(state);
+}
+
+
+
+// Функция потокового декодирования фрагмента base16
+size_t base16_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует очередной фрагмент Base16 (квант - 2 символа)
+ * 
+ * @param state Состояние, подготовленное base16_dec_init
+ * @param output Буфер для результата
+ * @param cap Размер буфера (не меньше base16_decoded_max_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных байтов или BASE_ERROR (позиция ошибки в state->error_offset)
+ */
+    return stream_decode_update(&base16_stream, state, input, len, output, cap);
+}
+
+
+
+// Функция завершения потокового декодирования base16
+size_t base16_dec_final(base_dec_state* state, unsigned char* output, size_t cap) {
+/**
+ * @brief Завершает поток Base16: непарный последний символ - ошибка
+ */
+    return stream_decode_final(&base16_stream, state, output, cap);
+}
+
+
+
+// Функция начала потокового декодирования base32
+void base32_dec_init(base_dec_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового декодирования
+ */
+    stream_decode_init(state);
+}
+
+
+
+// Функция потокового декодирования фрагмента base32
+size_t base32_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует очередной фрагмент Base32 (квант - 8 символов, включая '=')
+ * 
+ * @param state Состояние, подготовленное base32_dec_init
+ * @param output Буфер для результата
+ * @param cap Размер буфера (не меньше base32_decoded_max_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных байтов или BASE_ERROR (позиция ошибки в state->error_offset)
+ */
+    return stream_decode_update(&base32_stream, state, input, len, output, cap);
+}
+
+
+
+// Функция завершения потокового декодирования base32
+size_t base32_dec_final(base_dec_state* state, unsigned char* output, size_t cap) {
+/**
+ * @brief Завершает поток Base32: неполный последний квант считается дополненным '='
+ */
+    return stream_decode_final(&base32_stream, state, output, cap);
+}
+
+
+
+// Функция начала потокового декодирования base64
+void base64_dec_init(base_dec_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового декодирования
+ */
+    stream_decode_init(state);
+}
+
+
+
+// Функция потокового декодирования фрагмента base64
+size_t base64_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует очередной фрагмент Base64 (квант - 4 символа, включая '=')
+ * 
+ * @param state Состояние, подготовленное base64_dec_init
+ * @param output Буфер для результата
+ * @param cap Размер буфера (не меньше base64_decoded_max_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных байтов или BASE_ERROR (позиция ошибки в state->error_offset)
+ */
+    return stream_decode_update(&base64_stream, state, input, len, output, cap);
+}
+
+
+
+// Функция завершения потокового декодирования base64
+size_t base64_dec_final(base_dec_state* state, unsigned char* output, size_t cap) {
+/**
+ * @brief Завершает поток Base64: неполный последний квант считается дополненным '='
+ */
+    return stream_decode_final(&base64_stream, state, output, cap);
+}
+
+
+
+// Функция начала потокового декодирования base85
+void base85_dec_init(base_dec_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового декодирования
+ */
+    stream_decode_init(state);
+}
+
+
+
+// Функция потокового декодирования фрагмента base85
+size_t base85_dec_update(base_dec_state* state, const unsigned char* input, size_t len, unsigned char* output, size_t cap) {
+/**
+ * @brief Декодирует очередной фрагмент Base85 (квант - 5 символов)
+ * 
+ * @param state Состояние, подготовленное base85_dec_init
+ * @param output Буфер для результата
+ * @param cap Размер буфера (не меньше base85_decoded_max_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных байтов или BASE_ERROR (позиция ошибки в state->error_offset)
+ */
+    return stream_decode_update(&base85_stream, state, input, len, output, cap);
+}
+
+
+
+// Функция завершения потокового декодирования base85
+size_t base85_dec_final(base_dec_state* state, unsigned char* output, size_t cap) {
+/**
+ * @brief Завершает поток Base85: неполная последняя группа - ошибка
+ */
+    return stream_decode_final(&base85_stream, state, output, cap);
+}
+
+
+
+// Пробельные символы, которые декодер Base85 пропускает
+static int parallel_is_space(unsigned char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+
+
+// Функция поиска позиции ошибки во фрагменте входа
+static size_t parallel_error_offset(const stream_codec* codec, const unsigned char* input, size_t start, size_t end,
+                                    int skip_space) {
+/**
+ * @brief Находит символ, из-за которого декодер отверг фрагмент [start, end)
+ * 
+ * @param skip_space Пробельные символы не входят в группы (Base85)
+ * @return size_t Позиция первого недопустимого символа, а если таких нет - первого символа
+ *         незавершённой последней группы
+ */
+    size_t significant = 0;
+    size_t group_start = start;
+    for (size_t k = start; k < end; k++) {
+        unsigned char c = input[k];
+        if (skip_space && parallel_is_space(c)) {
+            continue;
+        }
+        if (codec->rev_table[c] == BASE_INVALID && (codec->padding == 0 || c != codec->padding)) {
+            return k;
+        }
+        if (significant++ % codec->quantum == 0) {
+            group_start = k;
+        }
+    }
+    return group_start;
+}
+
+
+
+// Данные параллельного декодирования: части входа и их участки выхода
+typedef struct {
+    const stream_codec* codec;
+    const unsigned char* input;
+    unsigned char* output;
+    size_t piece;             // символов входа на задачу (до выравнивания на группу)
+    size_t len;
+    size_t cap;
+    size_t count;             // число частей
+    size_t* in_start;         // начала частей во входе (count + 1 значение)
+    size_t* out_start;        // начала частей в выходе (count + 1 значение)
+    size_t* written;          // результат декодирования каждой части
+} parallel_decode_ctx;
+
+
+
+// Функция подсчёта значащих символов части входа Base85
+static void parallel_count_task(void* arg, size_t index) {
+/**
+ * @brief Считает символы части index без пробельных (результат в written[index])
+ */
+    const parallel_decode_ctx* ctx = (const parallel_decode_ctx*)arg;
+    size_t start = index * ctx->piece;
+    size_t end = ctx->len - start < ctx->piece ? ctx->len : start + ctx->piece;
+    size_t significant = 0;
+    for (size_t k = start; k < end; k++) {
+        significant += !parallel_is_space(ctx->input[k]);
+    }
+    ctx->written[index] = significant;
+}
+
+
+
+// Функция декодирования одной части входа
+static void parallel_decode_task(void* arg, size_t index) {
+/**
+ * @brief Декодирует часть index в её участок выхода
+ * 
+ * @note Часть начинается на границе группы, поэтому её результат начинается ровно
+ *       с out_start[index] и не пересекается с соседними; последней части доступен
+ *       весь остаток буфера
+ */
+    const parallel_decode_ctx* ctx = (const parallel_decode_ctx*)arg;
+    size_t start = ctx->in_start[index];
+    size_t room = (index + 1 < ctx->count ? ctx->out_start[index + 1] : ctx->cap) - ctx->out_start[index];
+    ctx->written[index] = ctx->codec->decode(ctx->input + start, ctx->in_start[index + 1] - start,
+                                             ctx->output + ctx->out_start[index], room);
+}
+
+
+
+// Функция параллельного декодирования
+static size_t parallel_decode(const stream_codec* codec, const unsigned char* input, size_t len, unsigned char* output,
+                              size_t cap, thread_pool* pool, size_t group_bytes, int skip_space, size_t* error_offset) {
+/**
+ * @brief Общая часть baseN_decode_parallel
+ * 
+ * @param group_bytes Байтов в полной группе кодека
+ * @param skip_space Пробельные символы пропускаются (Base85): границы частей сдвигаются
+ *                   так, чтобы перед каждой было кратное группе число значащих символов
+ * @param error_offset Позиция ошибки входа или BASE_ERROR, если мал буфер (может быть NULL)
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ * 
+ * @note Результат и позиция ошибки те же, что при декодировании в одном потоке: если
+ *       ошибки в нескольких частях, сообщается ошибка части с наименьшим началом
+ * @note Дополнение '=' внутри входа (не в последней части) укорачивает результат части;
+ *       такой вход декодируется заново в одном потоке, чтобы байты легли без пропусков
+ */
+    size_t offset = BASE_ERROR;
+    if (error_offset) {
+        *error_offset = BASE_ERROR;
+    }
+    if (!skip_space && cap < codec->decoded_max_len(len)) {
+        return BASE_ERROR;
+    }
+
+    // Ядра выбираются до запуска потоков, а не наперегонки в них
+    decode_dispatch();
+
+    int threads = thread_pool_size(pool);
+    size_t piece = len / ((size_t)threads * 4);
+    if (piece < PARALLEL_MIN_CHUNK) {
+        piece = PARALLEL_MIN_CHUNK;
+    }
+    piece = (piece + codec->quantum - 1) / codec->quantum * codec->quantum;
+    size_t count = (len + piece - 1) / piece;
+
+    size_t* bounds = NULL;
+    if (threads > 1 && len >= 2 * PARALLEL_MIN_CHUNK) {
+        bounds = (size_t*)malloc(3 * (count + 1) * sizeof(size_t));
+    }
+    if (!bounds) {
+        // Малый вход (или нет памяти под границы частей) декодируется в вызывающем потоке
+        size_t n = codec->decode(input, len, output, cap);
+        if (n == BASE_ERROR && error_offset &&
+            (!skip_space || cap >= codec->decoded_max_len(len))) {
+            *error_offset = parallel_error_offset(codec, input, 0, len, skip_space);
+        }
+        return n;
+    }
+
+    parallel_decode_ctx ctx = {codec, input, output, piece, len, cap, count,
+                               bounds, bounds + count + 1, bounds + 2 * (count + 1)};
+    for (size_t k = 0; k < count; k++) {
+        ctx.in_start[k] = k * piece;
+        ctx.out_start[k] = k * piece / codec->quantum * group_bytes;
+    }
+    ctx.in_start[count] = len;
+
+    if (skip_space) {
+        // Значащие символы каждой части, затем сдвиг границ на начало группы
+        thread_pool_run(pool, count, parallel_count_task, &ctx);
+        size_t significant = 0;
+        for (size_t k = 0; k < count; k++) {
+            size_t part = ctx.written[k];
+            if (k > 0 && ctx.in_start[k] <= ctx.in_start[k - 1]) {
+                // Предыдущая граница ушла за эту (часть почти из одних пробелов): часть пуста
+                ctx.in_start[k] = ctx.in_start[k - 1];
+                ctx.out_start[k] = ctx.out_start[k - 1];
+            } else if (k > 0) {
+                size_t pos = ctx.in_start[k];
+                size_t skip = (codec->quantum - significant % codec->quantum) % codec->quantum;
+                size_t counted = significant;
+                while (skip > 0 && pos < len) {
+                    skip -= !parallel_is_space(input[pos]);
+                    counted += !parallel_is_space(input[pos]);
+                    pos++;
+                }
+                ctx.in_start[k] = pos;
+                ctx.out_start[k] = counted / codec->quantum * group_bytes;
+            }
+            significant += part;
+        }
+        if (cap < significant / codec->quantum * group_bytes) {
+            free(bounds);
+            return BASE_ERROR;
+        }
+    }
+
+    thread_pool_run(pool, count, parallel_decode_task, &ctx);
+
+    size_t result = BASE_ERROR;
+    size_t k = 0;
+    for (; k < count; k++) {
+        if (ctx.written[k] == BASE_ERROR) {
+            offset = parallel_error_offset(codec, input, ctx.in_start[k], ctx.in_start[k + 1], skip_space);
+            break;
+        }
+        if (k + 1 < count && ctx.written[k] != ctx.out_start[k + 1] - ctx.out_start[k]) {
+            break;
+        }
+    }
+    if (k == count) {
+        result = ctx.out_start[count - 1] + ctx.written[count - 1];
+    } else if (offset == BASE_ERROR) {
+        result = codec->decode(input, len, output, cap);
+        if (result == BASE_ERROR) {
+            offset = parallel_error_offset(codec, input, 0, len, skip_space);
+        }
+    }
+
+    free(bounds);
+    if (error_offset) {
+        *error_offset = offset;
+    }
+    return result;
+}
+
+
+
+// Функция параллельного декодирования base16
+size_t base16_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset) {
+/**
+ * @brief Декодирует данные из Base16 на пуле потоков (части кратны 2 символам)
+ * 
+ * @param cap Размер буфера (не меньше base16_decoded_max_len(len))
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @param error_offset Позиция первого недопустимого символа (или последнего символа
+ *                     нечётного входа); BASE_ERROR, если мал буфер. Может быть NULL
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ */
+    return parallel_decode(&base16_stream, input, len, output, cap, pool, 1, 0, error_offset);
+}
+
+
+
+// Функция параллельного декодирования base32
+size_t base32_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset) {
+/**
+ * @brief Декодирует данные из Base32 на пуле потоков (части кратны 8 символам)
+ * 
+ * @param cap Размер буфера (не меньше base32_decoded_max_len(len))
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @param error_offset Позиция первого недопустимого символа; BASE_ERROR, если мал буфер.
+ *                     Может быть NULL
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ */
+    return parallel_decode(&base32_stream, input, len, output, cap, pool, 5, 0, error_offset);
+}
+
+
+
+// Функция параллельного декодирования base64
+size_t base64_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset) {
+/**
+ * @brief Декодирует данные из Base64 на пуле потоков (части кратны 4 символам)
+ * 
+ * @param cap Размер буфера (не меньше base64_decoded_max_len(len))
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @param error_offset Позиция первого недопустимого символа; BASE_ERROR, если мал буфер.
+ *                     Может быть NULL
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ */
+    return parallel_decode(&base64_stream, input, len, output, cap, pool, 3, 0, error_offset);
+}
+
+
+
+// Функция параллельного декодирования base85
+size_t base85_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset) {
+/**
+ * @brief Декодирует данные из Base85 на пуле потоков (пробелы и переводы строк пропускаются)
+ * 
+ * @param cap Размер буфера (base85_decoded_max_len(len) достаточно всегда)
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @param error_offset Позиция первого недопустимого символа или начала незавершённой
+ *                     последней группы; BASE_ERROR, если мал буфер. Может быть NULL
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ * 
+ * @note Сначала параллельно считаются значащие символы частей, по ним границы частей
+ *       сдвигаются на начало группы и вычисляются участки выхода
+ */
+    return parallel_decode(&base85_stream, input, len, output, cap, pool, 4, 1, error_offset);
+}
+
+
+
+// Функция поиска первого недопустимого символа Base58/Base62
+static size_t radix_error_offset(const unsigned char* input, size_t len, const unsigned char* rev_table) {
+/**
+ * @return size_t Позиция символа или BASE_ERROR, если все символы допустимы
+ */
+    for (size_t i = 0; i < len; i++) {
+        if (rev_table[input[i]] == BASE_INVALID) {
+            return i;
+        }
+    }
+    return BASE_ERROR;
+}
+
+
+
+// Функция параллельного декодирования base58
+size_t base58_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset) {
+/**
+ * @brief Декодирует данные из Base58 на пуле потоков (результат тот же, что у base58_decode_into)
+ * 
+ * @param cap Размер буфера (base58_decoded_max_len(len) достаточно всегда)
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @param error_offset Позиция первого недопустимого символа; BASE_ERROR, если ошибка не во
+ *                     входе (буфер мал, нет памяти). Может быть NULL
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ * 
+ * @note Вход - одно большое число, поэтому параллельно идёт его перевод в radix.c
+ */
+    size_t zero_count = 0;
+    while (zero_count < len && input[zero_count] == base58_table[0]) {
+        zero_count++;
+    }
+    size_t result = radix_decode_into(input + zero_count, len - zero_count, output, cap,
+                                      58, base58_rev_table, zero_count, 0, pool);
+    if (error_offset) {
+        *error_offset = result == BASE_ERROR ? radix_error_offset(input, len, base58_rev_table) : BASE_ERROR;
+    }
+    return result;
+}
+
+
+
+// Функция параллельного декодирования base62
+size_t base62_decode_parallel(const unsigned char* input, size_t len, unsigned char* output, size_t cap,
+                              thread_pool* pool, size_t* error_offset) {
+/**
+ * @brief Декодирует данные из Base62 на пуле потоков (результат тот же, что у base62_decode_into)
+ * 
+ * @param cap Размер буфера (base62_decoded_max_len(len) достаточно всегда)
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @param error_offset Позиция первого недопустимого символа; BASE_ERROR, если ошибка не во
+ *                     входе (пустой вход, буфер мал, нет памяти). Может быть NULL
+ * @return size_t Количество записанных байтов или BASE_ERROR
+ */
+    size_t result = len == 0 ? BASE_ERROR : radix_decode_into(input, len, output, cap, 62, base62_rev_table, 0, 1, pool);
+    if (error_offset) {
+        *error_offset = result == BASE_ERROR ? radix_error_offset(input, len, base62_rev_table) : BASE_ERROR;
+    }
+    return result;
+}
+
+
+
+// Таблица ядер декодирования, заполняемая один раз за процесс
+static decode_kernels decode_table;
+#ifdef DECODE_POSIX
+static pthread_once_t decode_once = PTHREAD_ONCE_INIT;
+#else
+static int decode_resolved = 0;
+#endif
+
+
+
+// Функция заполнения таблицы ядер декодирования
+static void decode_resolve(void) {
+/**
+ * @brief Связывает точки входа с лучшими ядрами для текущего процессора
+ * 
+ * @note Выбор выполняется по cpu_features() (с учётом ограничения BASE_CPU)
+ */
+#if defined(CPU_X86) || defined(CPU_ARM64)
+    unsigned int features = cpu_features();
+#endif
+
+    // 64-битные SWAR-ядра работают везде и заменяются векторными, если те доступны
+    decode_table.base16 = base16_decode_swar;
+    decode_table.base32 = base32_decode_swar;
+    decode_table.base64 = base64_decode_swar;
+
+#ifdef CPU_ARM64
+    if (features & CPU_NEON) {
+        decode_table.base16 = base16_decode_neon;
+        decode_table.base32 = base32_decode_neon;
+        decode_table.base64 = base64_decode_neon;
+    }
+#endif
+
+#ifdef CPU_X86
+    if (features & CPU_AVX2) {
+        decode_table.base16 = base16_decode_avx2;
+        decode_table.base32 = base32_decode_avx2;
+        decode_table.base64 = base64_decode_avx2;
+        decode_table.base85 = base85_decode_avx2;
+    } else if (features & CPU_SSSE3) {
+        decode_table.base16 = base16_decode_ssse3;
+        decode_table.base32 = base32_decode_ssse3;
+    }
+    if (features & CPU_AVX512VBMI) {
+        decode_table.base32 = base32_decode_vbmi;
+        decode_table.base64 = base64_decode_vbmi;
+    }
+#endif
+}
+
+
+
+// Функция выбора векторных ядер декодирования
+static const decode_kernels* decode_dispatch(void) {
+/**
+ * @brief Возвращает таблицу ядер, при первом вызове заполняя её
+ * 
+ * @return const decode_kernels* Таблица ядер (одна на процесс)
+ * 
+ * @note С pthreads таблица заполняется через pthread_once, и первый вызов из нескольких
+ *       потоков сразу безопасен. Без pthreads собственный пул работает в одном потоке;
+ *       вызывающий, создающий потоки сам, должен сначала вызвать decode_kernels_init()
+ */
+#ifdef DECODE_POSIX
+    pthread_once(&decode_once, decode_resolve);
+#else
+    if (!decode_resolved) {
+        decode_resolve();
+        decode_resolved = 1;
+    }
+#endif
+    return &decode_table;
+}
+
+
+
+// Функция заблаговременного выбора ядер декодирования
+void decode_kernels_init(void) {
+/**
+ * @brief Выбирает ядра декодирования в вызывающем потоке
+ * 
+ * @note С pthreads не обязательна (выбор защищён pthread_once); на платформах без
+ *       pthreads вызывается до запуска потоков, каждый из которых обращается к кодекам
+ */
+    decode_dispatch();
+}
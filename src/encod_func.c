@@ -15,6 +15,213 @@
 
 #include "../include/encod_func.h"
 #include "../include/tables.h"
+#include "../include/cpu_features.h"
+#include "../include/radix.h"
+#include "../include/swar.h"
+#include "../include/parallel.h"
+
+#ifdef CPU_X86
+#include <immintrin.h>
+#endif
+
+#ifdef CPU_ARM64
+#include <arm_neon.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ENCODE_POSIX 1
+#include <pthread.h>
+#endif
+
+
+
+// Векторное ядро кодирует начало входа и возвращает число обработанных байт
+typedef size_t (*encode_kernel)(const unsigned char* input, size_t len, char* output);
+
+// Ядра, выбранные для текущего процессора (NULL - только скалярный цикл)
+typedef struct {
+    encode_kernel base16;
+    encode_kernel base32;
+    encode_kernel base64;
+    size_t (*base85)(const unsigned char* input, size_t len, char* output, int options);
+} encode_kernels;
+
+static const encode_kernels* encode_dispatch(void);
+
+
+// Функция перевода восьми полубайтов числа в символы HEX (SWAR)
+static inline uint64_t base16_chars_swar(uint32_t value) {
+/**
+ * @brief Раздвигает полубайты value по байтам 64-битного слова и переводит их в символы
+ * 
+ * @return uint64_t Слово, старший байт которого - символ старшего полубайта
+ * 
+ * @note Полубайты 10-15 определяются по переносу в n + 6 и получают добавку 'A' - '0' - 10
+ */
+    uint64_t x = value;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+    const uint64_t letters = ((x + 6 * SWAR_ONES) >> 4) & SWAR_ONES;
+    return x + '0' * SWAR_ONES + letters * ('A' - '0' - 10);
+}
+
+
+
+// Функция кодирования блоками по 8 байт (SWAR)
+static size_t base16_encode_swar(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 8 байт в 16 символов HEX двумя 64-битными словами
+ * 
+ * @return size_t Количество обработанных байтов (кратно 8), остаток кодирует скалярный код
+ * 
+ * @note Переносимая замена векторным ядрам: не требует ничего, кроме 64-битной арифметики
+ */
+    size_t i = 0;
+    for (; len - i >= 8; i += 8) {
+        const uint64_t value = swar_load_be64(input + i);
+        swar_store_be64((unsigned char*)output + 2 * i, base16_chars_swar((uint32_t)(value >> 32)));
+        swar_store_be64((unsigned char*)output + 2 * i + 8, base16_chars_swar((uint32_t)value));
+    }
+    return i;
+}
+
+
+
+#ifdef CPU_ARM64
+// Функция кодирования блоками по 16 байт (NEON)
+static size_t base16_encode_neon(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 16 байт в 32 символа HEX за итерацию
+ * 
+ * @return size_t Количество обработанных байтов (кратно 16), остаток кодирует скалярный код
+ * 
+ * @note Полубайты переводятся в символы через tbl, vst2 чередует старшие и младшие
+ */
+    const uint8x16_t table = vld1q_u8((const uint8_t*)base16_table);
+    const uint8x16_t mask = vdupq_n_u8(0x0F);
+    size_t i = 0;
+
+    for (; len - i >= 16; i += 16) {
+        const uint8x16_t in = vld1q_u8(input + i);
+        uint8x16x2_t chars;
+        chars.val[0] = vqtbl1q_u8(table, vshrq_n_u8(in, 4));
+        chars.val[1] = vqtbl1q_u8(table, vandq_u8(in, mask));
+        vst2q_u8((uint8_t*)output + 2 * i, chars);
+    }
+    return i;
+}
+#endif
+
+
+
+#ifdef CPU_X86
+// Функция кодирования блоками по 16 байт (SSSE3)
+__attribute__((target("ssse3")))
+static size_t base16_encode_ssse3(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 16 байт в 32 символа HEX за итерацию
+ * 
+ * @return size_t Количество обработанных байтов, остаток кодирует скалярный код
+ * 
+ * @note Полубайты разделяются сдвигом и маской, символы берутся из таблицы через pshufb
+ */
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                         '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m128i low_mask = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+
+    for (; len - i >= 16; i += 16) {
+        const __m128i in = _mm_loadu_si128((const __m128i*)(input + i));
+        const __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(in, 4), low_mask));
+        const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(in, low_mask));
+
+        // Чередуем старший и младший полубайты каждого байта
+        _mm_storeu_si128((__m128i*)(output + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)(output + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    return i;
+}
+
+
+
+// Функция кодирования блоками по 32 байта (AVX2)
+__attribute__((target("avx2")))
+static size_t base16_encode_avx2(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 32 байта в 64 символа HEX за итерацию
+ * 
+ * @return size_t Количество обработанных байтов, остаток кодирует скалярный код
+ */
+    const __m256i digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+                                            '0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m256i low_mask = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+
+    for (; len - i >= 32; i += 32) {
+        const __m256i in = _mm256_loadu_si256((const __m256i*)(input + i));
+        const __m256i hi = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(in, 4), low_mask));
+        const __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(in, low_mask));
+
+        // unpack работает внутри 128-битных половин, поэтому половины переставляем после него
+        const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256((__m256i*)(output + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256((__m256i*)(output + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+    return i;
+}
+#endif
+
+
+
+// Функция длины результата кодирования base16
+size_t base16_encoded_len(size_t len) {
+/**
+ * @brief Возвращает точную длину строки Base16 для len байтов (без завершающего нуля)
+ */
+    return 2 * len;
+}
+
+
+
+// Функция кодирования base16 в буфер вызывающего
+size_t base16_encode_into(const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в Base16 без выделения памяти
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для результата (завершающий ноль не пишется).
+ * @param cap Размер буфера (не меньше base16_encoded_len(len)).
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал.
+ * 
+ * @note Основная часть данных кодируется векторным ядром, выбранным по cpuid.
+ */
+    if (cap < base16_encoded_len(len)) {
+        return BASE_ERROR;
+    }
+
+    size_t i = 0;
+
+    const encode_kernels* kernels = encode_dispatch();
+    if (kernels->base16) {
+        i = kernels->base16(input, len, output);
+    }
+
+    // Проходим по оставшимся байтам входных данных
+    for (; i < len; i++) {
+        // Кодируем старший и младший полубайты
+        output[2 * i] = base16_table[(input[i] >> 4) & 0x0F]; // Старший полубайт
+        output[2 * i + 1] = base16_table[input[i] & 0x0F];    // Младший полубайт
+    }
+
+    return 2 * len;
+}
+
 
 
 // Функция кодирования исходного файла base16 - алгоритмом --- РАБОТАЕТ
@@ -28,275 +235,1721 @@ char* base16_encode(const unsigned char *input, size_t input_len, char *output)
  * @return char* Указатель на закодированную строку (тот же, что и `output`).
  * 
  * @note Каждый байт входных данных кодируется двумя символами HEX (0-9, A-F).
+ * @note Кодирует через base16_encode_into и дописывает завершающий ноль.
  * 
  * @example
  * unsigned char data[] = {0xAB, 0xCD};
  * char encoded[5];
  * base16_encode(data, 2, encoded); // Результат: "ABCD"
  */
-    // Таблица символов Base16
-    const char *base16_chars = "0123456789ABCDEF";
-
-    // Проходим по каждому байту входных данных
-    for (size_t i = 0; i < input_len; i++) {
-        // Кодируем старший и младший полубайты
-        output[2 * i] = base16_chars[(input[i] >> 4) & 0x0F]; // Старший полубайт
-        output[2 * i + 1] = base16_chars[input[i] & 0x0F];    // Младший полубайт
-    }
+    size_t output_len = base16_encode_into(input, input_len, output, base16_encoded_len(input_len));
 
     // Завершаем строку нулевым символом
-    output[2 * input_len] = '\0';
+    output[output_len] = '\0';
     return output;
 }
 
 
 
-// Функция кодирования исходного файла base32 - алгоритмом --- РАБОТАЕТ
-char* base32_encode(const char* input, size_t len, char* output) {
+// Функция кодирования блоками по 5 байт (SWAR)
+static size_t base32_encode_swar(const unsigned char* input, size_t len, char* output) {
 /**
- * @brief Кодирует данные в формат Base32.
+ * @brief Кодирует группу из 5 байт в 8 символов Base32 одним 64-битным словом
  * 
- * @param input Указатель на входные данные.
- * @param len Длина входных данных в байтах.
- * @param output Буфер для записи результата (должен быть достаточного размера).
- * @return char* Указатель на закодированную строку.
+ * @return size_t Количество обработанных байтов (кратно 5), остаток кодирует скалярный код
+ * 
+ * @note 40-битная группа раздвигается по байтам слова (5 бит в каждом), символы получаются
+ *       без таблицы: 'A' + n, а для n >= 26 ещё минус 'A' + 26 - '2'
+ * @note Читает по 8 байт, поэтому оставляет скалярному коду последние 3-7 байт
+ */
+    size_t i = 0, j = 0;
+    for (; len - i >= 8; i += 5, j += 8) {
+        uint64_t x = swar_load_be64(input + i) >> 24;
+        x = (x & 0x00000000000FFFFFULL) | ((x & 0x000000FFFFF00000ULL) << 12);
+        x = (x & 0x000003FF000003FFULL) | ((x & 0x000FFC00000FFC00ULL) << 6);
+        x = (x & 0x001F001F001F001FULL) | ((x & 0x03E003E003E003E0ULL) << 3);
+
+        const uint64_t digits = swar_ge(x, 26) >> 7;
+        x = x + 'A' * SWAR_ONES - digits * ('A' + 26 - '2');
+        swar_store_be64((unsigned char*)output + j, x);
+    }
+    return i;
+}
+
+
+
+#ifdef CPU_ARM64
+// Функция кодирования блоками по 80 байт (NEON)
+static size_t base32_encode_neon(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 80 байт (16 групп) в 128 символов Base32 за итерацию
  * 
- * @note Используется таблица символов `base32_table` из `tables.h`.
+ * @return size_t Количество обработанных байтов (кратно 80), остаток кодирует скалярный код
  * 
- * @example
- * const char data[] = "Hello";
- * char encoded[20];
- * base32_encode(data, 5, encoded); // Результат: "JBSWY3DP"
+ * @note Загрузки с шагом 5 нет, поэтому байты групп собираются tbl по индексам 5j + k;
+ *       восемь потоков символов чередуются через zip и vst4 по 16 бит
  */
-    int i, j;
-    unsigned int val = 0;
-    int bit_count = 0;
-    size_t output_len = (len * 8 + 4) / 5; // длина выходного массива Base32
-    for (i = 0, j = 0; i < len; i++) {
-        val = (val << 8) | (unsigned char)input[i];
-        bit_count += 8;
-        while (bit_count >= 5) {
-            output[j++] = base32_table[(val >> (bit_count - 5)) & 0x1F];
-            bit_count -= 5;
+    static const uint8_t stride5[16] = {0, 5, 10, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 75};
+    const uint8x16_t offsets = vld1q_u8(stride5);
+    uint8x16x2_t table;
+    table.val[0] = vld1q_u8((const uint8_t*)base32_table);
+    table.val[1] = vld1q_u8((const uint8_t*)base32_table + 16);
+    const uint8x16_t mask = vdupq_n_u8(0x1F);
+    size_t i = 0, j = 0;
+
+    for (; len - i >= 80; i += 80, j += 128) {
+        uint8x16x4_t head;
+        head.val[0] = vld1q_u8(input + i);
+        head.val[1] = vld1q_u8(input + i + 16);
+        head.val[2] = vld1q_u8(input + i + 32);
+        head.val[3] = vld1q_u8(input + i + 48);
+        const uint8x16_t tail = vld1q_u8(input + i + 64);
+
+        // b[k] - k-й байт каждой из 16 групп
+        uint8x16_t b[5];
+        for (int k = 0; k < 5; k++) {
+            const uint8x16_t index = vaddq_u8(offsets, vdupq_n_u8((uint8_t)k));
+            b[k] = vqtbx1q_u8(vqtbl4q_u8(head, index), tail, vsubq_u8(index, vdupq_n_u8(64)));
         }
+
+        uint8x16_t c[8];
+        c[0] = vshrq_n_u8(b[0], 3);
+        c[1] = vandq_u8(vorrq_u8(vshlq_n_u8(b[0], 2), vshrq_n_u8(b[1], 6)), mask);
+        c[2] = vandq_u8(vshrq_n_u8(b[1], 1), mask);
+        c[3] = vandq_u8(vorrq_u8(vshlq_n_u8(b[1], 4), vshrq_n_u8(b[2], 4)), mask);
+        c[4] = vandq_u8(vorrq_u8(vshlq_n_u8(b[2], 1), vshrq_n_u8(b[3], 7)), mask);
+        c[5] = vandq_u8(vshrq_n_u8(b[3], 2), mask);
+        c[6] = vandq_u8(vorrq_u8(vshlq_n_u8(b[3], 3), vshrq_n_u8(b[4], 5)), mask);
+        c[7] = vandq_u8(b[4], mask);
+
+        // Пары потоков склеиваются в 16-битные элементы, vst4 чередует четыре пары
+        uint16x8x4_t low, high;
+        for (int k = 0; k < 4; k++) {
+            const uint8x16x2_t pair = vzipq_u8(vqtbl2q_u8(table, c[2 * k]), vqtbl2q_u8(table, c[2 * k + 1]));
+            low.val[k] = vreinterpretq_u16_u8(pair.val[0]);
+            high.val[k] = vreinterpretq_u16_u8(pair.val[1]);
+        }
+        vst4q_u16((uint16_t*)(output + j), low);
+        vst4q_u16((uint16_t*)(output + j + 64), high);
     }
-    if (bit_count > 0) {
-        output[j++] = base32_table[(val << (5 - bit_count)) & 0x1F];
-    }
-    output[j] = '\0';
-    return output;
+    return i;
 }
+#endif
 
 
 
-// Функция кодирования исходного файла base58 - алгоритмом --- РАБОТАЕТ
-char* base58_encode(const unsigned char* input, size_t len, char* output) {
+#ifdef CPU_X86
+// Функция выделения восьми 5-битных индексов группы Base32 (SSSE3)
+__attribute__((target("ssse3")))
+static inline __m128i base32_indices_ssse3(__m128i in, __m128i shuffle) {
 /**
- * @brief Кодирует данные в формат Base58 (используется в Bitcoin-адресах).
+ * @brief Раскладывает группу из 5 байт в восемь 16-битных слов с индексами 0-31
  * 
- * @param input Указатель на входные данные.
- * @param len Длина входных данных в байтах.
- * @param output Буфер для записи результата (должен быть достаточного размера).
- * @return char* Указатель на закодированную строку или `NULL` при ошибке.
+ * @note Символ c занимает биты [5c, 5c + 5) группы, считая от старшего. Слово c собирается
+ *       из байтов a = 5c / 8 и a + 1 (старший первым), умножение на 2^(5c - 8a) поднимает
+ *       нужные биты к вершине слова, сдвиг вправо на 11 оставляет ровно 5 бит
+ */
+    const __m128i words = _mm_shuffle_epi8(in, shuffle);
+    const __m128i raised = _mm_mullo_epi16(words, _mm_setr_epi16(1 << 0, 1 << 5, 1 << 2, 1 << 7,
+                                                                 1 << 4, 1 << 1, 1 << 6, 1 << 11));
+    return _mm_srli_epi16(raised, 11);
+}
+
+
+
+// Функция преобразования 5-битных индексов в символы Base32 (SSSE3)
+__attribute__((target("ssse3")))
+static inline __m128i base32_lookup_ssse3(__m128i indices) {
+/**
+ * @brief 0..25 -> 'A'..'Z', 26..31 -> '2'..'7'
+ */
+    const __m128i digits = _mm_cmpgt_epi8(indices, _mm_set1_epi8(25));
+    const __m128i shifted = _mm_add_epi8(indices, _mm_set1_epi8('A'));
+    return _mm_sub_epi8(shifted, _mm_and_si128(digits, _mm_set1_epi8('A' + 26 - '2')));
+}
+
+
+
+// Функция кодирования блоками по 10 байт (SSSE3)
+__attribute__((target("ssse3")))
+static size_t base32_encode_ssse3(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 10 байт (две группы) в 16 символов Base32 за итерацию
  * 
- * @note Ведущие нули кодируются как '1'.
- * @warning Требует выделения памяти внутри функции.
+ * @return size_t Количество обработанных байтов (кратно 5), остаток кодирует скалярный код
  * 
- * @example
- * unsigned char data[] = {0x00, 0xAB, 0xCD};
- * char encoded[10];
- * base58_encode(data, 3, encoded); // Результат: "1qfr"
+ * @note Загрузка читает 16 байт, поэтому цикл останавливается за 6 байт до конца входа
  */
-    unsigned int carry;
-    size_t i, j, output_len;
+    // Пары байтов (a + 1, a) для a = 0, 0, 1, 1, 2, 3, 3, 3 в первой и второй группе
+    const __m128i shuffle0 = _mm_setr_epi8(1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 4, 3);
+    const __m128i shuffle1 = _mm_add_epi8(shuffle0, _mm_set1_epi8(5));
+    size_t i = 0, j = 0;
 
-    // Выделяем память с запасом
-    unsigned char* result = (unsigned char*)calloc(len * 138 / 100 + 1, sizeof(unsigned char));
-    if (!result) {
-        perror("Ошибка выделения памяти для результата");
-        return NULL;
+    for (; len - i >= 16; i += 10, j += 16) {
+        const __m128i in = _mm_loadu_si128((const __m128i*)(input + i));
+        const __m128i indices = _mm_packus_epi16(base32_indices_ssse3(in, shuffle0),
+                                                 base32_indices_ssse3(in, shuffle1));
+        _mm_storeu_si128((__m128i*)(output + j), base32_lookup_ssse3(indices));
     }
+    return i;
+}
 
-    // Обработка ведущих нулей
-    for (i = 0; i < len && input[i] == 0; i++) {
-        output[i] = '1'; // Каждый ведущий ноль кодируется как '1'
-    }
-    j = i; // Индекс для записи результата
 
-    // Главный цикл кодирования
-    for (; i < len; i++) {
-        carry = input[i];
-        for (size_t k = 0; k < j; k++) {
-            carry += 256 * result[k];
-            result[k] = carry % 58;
-            carry /= 58;
-        }
-        // Обрабатываем остаток от деления
-        while (carry > 0) {
-            result[j++] = carry % 58;
-            carry /= 58;
-        }
+
+// Функция выделения 5-битных индексов двух групп Base32 (AVX2)
+__attribute__((target("avx2")))
+static inline __m256i base32_indices_avx2(__m256i in, __m256i shuffle) {
+/**
+ * @brief 256-битный вариант base32_indices_ssse3: по одной группе в каждой половине регистра
+ */
+    const __m256i words = _mm256_shuffle_epi8(in, shuffle);
+    const __m256i raised = _mm256_mullo_epi16(words, _mm256_setr_epi16(
+        1 << 0, 1 << 5, 1 << 2, 1 << 7, 1 << 4, 1 << 1, 1 << 6, 1 << 11,
+        1 << 0, 1 << 5, 1 << 2, 1 << 7, 1 << 4, 1 << 1, 1 << 6, 1 << 11));
+    return _mm256_srli_epi16(raised, 11);
+}
+
+
+
+// Функция кодирования блоками по 20 байт (AVX2)
+__attribute__((target("avx2")))
+static size_t base32_encode_avx2(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 20 байт (четыре группы) в 32 символа Base32 за итерацию
+ * 
+ * @return size_t Количество обработанных байтов (кратно 5), остаток кодирует скалярный код
+ * 
+ * @note Каждая 128-битная половина получает свои 10 байт отдельной загрузкой. Упаковка
+ *       работает внутри половин, поэтому группы 0 и 1 оказываются в младшей половине,
+ *       а 2 и 3 - в старшей, и перестановка между половинами не нужна
+ */
+    const __m256i shuffle0 = _mm256_setr_epi8(
+        1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 4, 3,
+        1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 4, 3);
+    const __m256i shuffle1 = _mm256_add_epi8(shuffle0, _mm256_set1_epi8(5));
+    size_t i = 0, j = 0;
+
+    for (; len - i >= 26; i += 20, j += 32) {
+        const __m128i lo = _mm_loadu_si128((const __m128i*)(input + i));
+        const __m128i hi = _mm_loadu_si128((const __m128i*)(input + i + 10));
+        const __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        const __m256i indices = _mm256_packus_epi16(base32_indices_avx2(in, shuffle0),
+                                                    base32_indices_avx2(in, shuffle1));
+        const __m256i digits = _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25));
+        const __m256i shifted = _mm256_add_epi8(indices, _mm256_set1_epi8('A'));
+        const __m256i chars = _mm256_sub_epi8(shifted, _mm256_and_si256(digits, _mm256_set1_epi8('A' + 26 - '2')));
+        _mm256_storeu_si256((__m256i*)(output + j), chars);
     }
+    return i;
+}
+
+
+
+// Функция кодирования блоками по 40 байт (AVX-512 VBMI)
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static size_t base32_encode_vbmi(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 40 байт (восемь групп) в 64 символа Base32 за итерацию
+ * 
+ * @return size_t Количество обработанных байтов - все полные группы по 5 байт
+ * 
+ * @note Каждая группа разворачивается в 40-битное число в своём 64-битном слове,
+ *       vpmultishiftqb выделяет восемь 5-битных полей, vpermb переводит их в символы
+ * @note Хвост загружается и записывается по маске, скалярному коду остаётся только
+ *       неполная группа
+ */
+    // Байты группы в обратном порядке: младшие 40 бит слова - число b0..b4
+    const __m512i shuffle = _mm512_setr_epi64(
+        0x0000000001020304LL, 0x0000000506070809LL, 0x0000000A0B0C0D0ELL, 0x0000000F10111213LL,
+        0x0000001415161718LL, 0x000000191A1B1C1DLL, 0x0000001E1F202122LL, 0x0000002324252627LL);
+    // Сдвиги полей 35, 30, ..., 0 для символов 0..7 группы
+    const __m512i shifts = _mm512_set1_epi64(0x00050A0F14191E23LL);
+    // vpermb берёт 6 бит индекса, поэтому алфавит повторяется в обеих половинах
+    const __m512i lookup = _mm512_broadcast_i64x4(_mm256_loadu_si256((const __m256i*)base32_table));
+    size_t i = 0, j = 0;
 
-    // Вычисляем длину результата
-    output_len = j;
-    // Преобразуем результат в строку символов
-    for (i = 0; i < output_len; i++) {
-        output[i] = base58_table[result[output_len - i - 1]];
+    while (len - i >= 5) {
+        const size_t n = (len - i >= 40) ? 40 : (len - i) / 5 * 5;
+        const __mmask64 in_mask = ((__mmask64)1 << n) - 1;
+        const __mmask64 out_mask = (n == 40) ? ~(__mmask64)0 : ((__mmask64)1 << (n / 5 * 8)) - 1;
+
+        const __m512i in = _mm512_permutexvar_epi8(shuffle, _mm512_maskz_loadu_epi8(in_mask, input + i));
+        const __m512i indices = _mm512_multishift_epi64_epi8(shifts, in);
+        _mm512_mask_storeu_epi8(output + j, out_mask, _mm512_permutexvar_epi8(indices, lookup));
+        i += n;
+        j += n / 5 * 8;
     }
-    output[output_len] = '\0';  // Завершаем строку
+    return i;
+}
+#endif
 
-    // Освобождаем память
-    free(result);
 
-    return output;
+
+// Функция длины результата кодирования base32
+size_t base32_encoded_len(size_t len) {
+/**
+ * @brief Возвращает точную длину строки Base32 для len байтов (без '=' и завершающего нуля)
+ */
+    return len / 5 * 8 + (len % 5 * 8 + 4) / 5;
 }
 
 
 
-// Функция кодирования исходного файла base62 - алгоритмом --- РАБОТАЕТ
-char* base62_encode(const unsigned char* input, size_t len, char* output) {
+// Функция кодирования base32 в буфер вызывающего
+size_t base32_encode_into(const unsigned char* input, size_t len, char* output, size_t cap) {
 /**
- * @brief Кодирует данные в формат Base62 (0-9, A-Z, a-z).
+ * @brief Кодирует данные в Base32 без выделения памяти
  * 
  * @param input Указатель на входные данные.
  * @param len Длина входных данных в байтах.
- * @param output Буфер для записи результата (должен быть достаточного размера).
- * @return char* Указатель на закодированную строку или `NULL` при ошибке.
+ * @param output Буфер для результата (завершающий ноль не пишется).
+ * @param cap Размер буфера (не меньше base32_encoded_len(len)).
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал.
  * 
- * @note Используется таблица символов `base62_table` из `tables.h`.
- * @warning Требует выделения памяти внутри функции.
+ * @note Полные группы по 5 байт кодируются векторным ядром (AVX-512 VBMI, AVX2 или SSSE3), выбранным
+ *       по cpuid; скалярный цикл собирает группу в 40-битное число и дописывает хвост.
  */
-    unsigned int carry;
-    size_t i, j, output_len;
-    unsigned char* result = (unsigned char*)malloc(len * 2); // Максимальная длина результата
+    if (cap < base32_encoded_len(len)) {
+        return BASE_ERROR;
+    }
 
-    if (!result) {
-        perror("Ошибка выделения памяти для результата");
-        return NULL;
+    size_t i = 0, j;
+
+    const encode_kernels* kernels = encode_dispatch();
+    if (kernels->base32) {
+        i = kernels->base32(input, len, output);
     }
+    j = i / 5 * 8;
 
-    // Главный цикл кодирования
-    for (i = 0, j = 0; i < len; i++) {
-        carry = input[i];
-        for (size_t k = 0; k < j; k++) {
-            carry += 256 * result[k];
-            result[k] = carry % 62;
-            carry /= 62;
-        }
-        // Обрабатываем остаток от деления
-        while (carry > 0) {
-            result[j++] = carry % 62;
-            carry /= 62;
+    // Полные группы: 5 байт -> 8 символов
+    for (; len - i >= 5; i += 5) {
+        uint64_t value = ((uint64_t)input[i] << 32) | ((uint64_t)input[i + 1] << 24) |
+                         ((uint64_t)input[i + 2] << 16) | ((uint64_t)input[i + 3] << 8) | input[i + 4];
+        for (int k = 7; k >= 0; k--) {
+            output[j + k] = base32_table[value & 0x1F];
+            value >>= 5;
         }
+        j += 8;
     }
 
-    // Вычисляем длину результата
-    output_len = j;
-    // Преобразуем результат в строку символов
-    for (i = 0; i < output_len; i++) {
-        output[i] = base62_table[result[output_len - i - 1]];
+    // Неполная группа: недостающие биты последнего символа заполняются нулями
+    if (i < len) {
+        size_t rest = len - i;
+        uint64_t value = 0;
+        for (size_t k = 0; k < rest; k++) {
+            value |= (uint64_t)input[i + k] << (32 - 8 * k);
+        }
+        size_t chars = (rest * 8 + 4) / 5;
+        for (size_t k = 0; k < chars; k++) {
+            output[j++] = base32_table[(value >> (35 - 5 * k)) & 0x1F];
+        }
     }
-    output[output_len] = '\0';  // Завершаем строку
-
-    // Освобождаем память
-    free(result);
-
-    return output;
+    return j;
 }
 
 
 
-// Функция кодирования исходного файла base64 - алгоритмом --- РАБОТАЕТ
-char* base64_encode(const unsigned char* input, size_t len) {
+// Функция кодирования исходного файла base32 - алгоритмом --- РАБОТАЕТ
+char* base32_encode(const char* input, size_t len, char* output) {
 /**
- * @brief Кодирует данные в формат Base64.
+ * @brief Кодирует данные в формат Base32.
  * 
  * @param input Указатель на входные данные.
  * @param len Длина входных данных в байтах.
- * @return char* Указатель на закодированную строку (нужно освободить через `free()`).
+ * @param output Буфер для записи результата (не меньше `base32_encoded_len(len) + 1`).
+ * @return char* Указатель на закодированную строку.
  * 
- * @note Дополнение '=' добавляется, если длина не кратна 3.
- * @warning Выделяет память внутри функции.
+ * @note Используется таблица символов `base32_table` из `tables.h`, дополнение '=' не пишется.
+ * @note Кодирует через base32_encode_into и дописывает завершающий ноль.
  * 
  * @example
- * unsigned char data[] = {0xAB, 0xCD, 0xEF};
- * char* encoded = base64_encode(data, 3); // Результат: "q83D"
- * free(encoded);
+ * const char data[] = "Hello";
+ * char encoded[20];
+ * base32_encode(data, 5, encoded); // Результат: "JBSWY3DP"
  */
-    // Вычисляем длину выходной строки
-    size_t output_len = 4 * ((len + 2) / 3); // Каждые 3 байта кодируются в 4 символа
-    char* output = (char*)malloc(output_len + 1); // +1 для завершающего нуля
-    if (!output) return NULL;
+    size_t output_len = base32_encode_into((const unsigned char*)input, len, output, base32_encoded_len(len));
+    output[output_len] = '\0';
+    return output;
+}
 
-    size_t i, j;
-    uint32_t val;
 
-    for (i = 0, j = 0; i < len; i += 3) {
-        // Собираем 24-битное значение из 3 байтов
-        val = (input[i] << 16) | ((i + 1 < len ? input[i + 1] : 0) << 8) | (i + 2 < len ? input[i + 2] : 0);
 
-        // Разбиваем на 4 группы по 6 бит и кодируем в Base64
-        output[j++] = base64_table[(val >> 18) & 0x3F];
-        output[j++] = base64_table[(val >> 12) & 0x3F];
-        output[j++] = (i + 1 < len) ? base64_table[(val >> 6) & 0x3F] : '=';
-        output[j++] = (i + 2 < len) ? base64_table[val & 0x3F] : '=';
+// Функция перевода байтов в цифры системы счисления radix в буфер вызывающего
+static size_t radix_encode_into(const unsigned char* input, size_t len, char* output, size_t cap,
+                                uint32_t radix, const char* table, size_t min_len, thread_pool* pool) {
+/**
+ * @brief Общая часть base58_encode_into и base62_encode_into
+ * 
+ * @param min_len Наименьшая длина результата: недостающие старшие цифры дополняются нулевым
+ *                символом алфавита (для Base58 - число ведущих нулевых байтов)
+ * @param pool Пул потоков для рекурсивного перевода (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных символов или BASE_ERROR
+ * 
+ * @note Слова числа лежат на стеке, пока их не больше RADIX_STACK_LIMBS; длинные входы
+ *       переводятся во временном буфере в куче (рекурсивный перевод в radix.c выделяет
+ *       память и сам, его стоимость всё равно намного больше выделения)
+ */
+    uint32_t stack_limbs[RADIX_STACK_LIMBS];
+    const uint32_t limb_base = radix * radix * radix * radix * radix;
+
+    // Слова по основанию radix^5: не больше 0.274 слова на входной байт
+    size_t limbs_size = len * 28 / 100 + 2;
+    uint32_t* limbs = stack_limbs;
+    if (limbs_size > RADIX_STACK_LIMBS) {
+        limbs = (uint32_t*)malloc(limbs_size * sizeof(uint32_t));
+        if (!limbs) {
+            return BASE_ERROR;
+        }
     }
 
-    output[j] = '\0'; // Завершаем строку
-    return output;
+    size_t result = BASE_ERROR;
+    size_t count = radix_from_bytes_parallel(input, len, limbs, limb_base, pool);
+    if (count != RADIX_ERROR) {
+        // Точная длина известна до записи цифр: буфер проверяется без лишнего запаса
+        size_t digits = radix_limbs_chars_len(limbs, count, radix);
+        size_t output_len = digits < min_len ? min_len : digits;
+        if (output_len <= cap) {
+            memset(output, table[0], output_len - digits);
+            radix_limbs_to_chars(limbs, count, radix, table, output + (output_len - digits));
+            result = output_len;
+        }
+    }
+
+    if (limbs != stack_limbs) {
+        free(limbs);
+    }
+    return result;
 }
 
 
 
-// Функция кодирования исходного файла base85 - алгоритмом --- РАБОТАЕТ
-char* base85_encode(const unsigned char* input, size_t len) {
+// Функция длины результата кодирования base58
+size_t base58_encoded_len(size_t len) {
 /**
- * @brief Кодирует данные в формат Base85 (используется в PDF и PostScript).
+ * @brief Возвращает верхнюю оценку длины строки Base58 для len байтов (без завершающего нуля)
+ * 
+ * @note Точная длина зависит от значения числа: log58(256) < 1.37 цифры на байт
+ */
+    return len * 137 / 100 + 1;
+}
+
+
+
+// Функция кодирования base58 в буфер вызывающего
+size_t base58_encode_into(const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в Base58 без выделения памяти под результат
  * 
  * @param input Указатель на входные данные.
  * @param len Длина входных данных в байтах.
- * @return char* Указатель на закодированную строку (нужно освободить через `free()`).
+ * @param output Буфер для результата (завершающий ноль не пишется).
+ * @param cap Размер буфера: base58_encoded_len(len) достаточно всегда, но проверяется
+ *            точная длина результата.
+ * @return size_t Количество записанных символов или BASE_ERROR (буфер мал, нет памяти).
  * 
- * @note Каждые 4 байта кодируются в 5 символов.
- * @warning Выделяет память внутри функции.
+ * @note Ведущие нули кодируются как '1': результат дополняется символами '1'
+ *       до длины, не меньшей количества ведущих нулевых байтов.
+ * @note Входы короче ~3.6 КБ переводятся без обращения к куче (см. RADIX_STACK_LIMBS).
  */
-    // Вычисляем размер выходного буфера
-    size_t output_len = ((len + 3) / 4) * 5 + 1; // +1 для завершающего нуля
-    char* output = (char*)malloc(output_len);
-    if (!output) {
+    size_t zeros = 0;
+    while (zeros < len && input[zeros] == 0) {
+        zeros++;
+    }
+    return radix_encode_into(input + zeros, len - zeros, output, cap, 58, base58_table, zeros, NULL);
+}
+
+
+
+// Функция кодирования исходного файла base58 - алгоритмом --- РАБОТАЕТ
+char* base58_encode(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует данные в формат Base58 (используется в Bitcoin-адресах).
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для записи результата (не меньше `base58_encoded_len(len) + 1`).
+ * @return char* Указатель на закодированную строку или `NULL` при ошибке.
+ * 
+ * @note Число хранится в 32-битных словах по основанию 58^5 (см. radix.c): за одно
+ *       умножение вносится 4 входных байта, деление на константу заменяется умножением.
+ * @note Кодирует через base58_encode_into и дописывает завершающий ноль.
+ * 
+ * @example
+ * unsigned char data[] = {0x00, 0xAB, 0xCD};
+ * char encoded[10];
+ * base58_encode(data, 3, encoded); // Результат: "E5J"
+ */
+    size_t output_len = base58_encode_into(input, len, output, base58_encoded_len(len));
+    if (output_len == BASE_ERROR) {
         perror("Ошибка выделения памяти для результата");
         return NULL;
     }
+    output[output_len] = '\0';  // Завершаем строку
 
-    char* ptr = output;
+    return output;
+}
 
-    // Обрабатываем входные данные блоками по 4 байта
-    for (size_t i = 0; i < len; i += 4) {
-        // Считываем блок из 4 байтов (дополняем нулями, если нужно)
+
+
+// Функция длины результата кодирования base62
+size_t base62_encoded_len(size_t len) {
+/**
+ * @brief Возвращает верхнюю оценку длины строки Base62 для len байтов (без завершающего нуля)
+ * 
+ * @note Точная длина зависит от значения числа: log62(256) < 1.35 цифры на байт
+ */
+    return len * 135 / 100 + 1;
+}
+
+
+
+// Функция кодирования base62 в буфер вызывающего
+size_t base62_encode_into(const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в Base62 без выделения памяти под результат
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для результата (завершающий ноль не пишется).
+ * @param cap Размер буфера: base62_encoded_len(len) достаточно всегда, но проверяется
+ *            точная длина результата.
+ * @return size_t Количество записанных символов или BASE_ERROR (буфер мал, нет памяти).
+ * 
+ * @note Входы короче ~3.6 КБ переводятся без обращения к куче (см. RADIX_STACK_LIMBS).
+ */
+    return radix_encode_into(input, len, output, cap, 62, base62_table, 0, NULL);
+}
+
+
+
+// Функция кодирования исходного файла base62 - алгоритмом --- РАБОТАЕТ
+char* base62_encode(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует данные в формат Base62 (0-9, A-Z, a-z).
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для записи результата (не меньше `base62_encoded_len(len) + 1`).
+ * @return char* Указатель на закодированную строку или `NULL` при ошибке.
+ * 
+ * @note Используется таблица символов `base62_table` из `tables.h`.
+ * @note Число хранится в 32-битных словах по основанию 62^5 (см. radix.c).
+ * @note Кодирует через base62_encode_into и дописывает завершающий ноль.
+ */
+    size_t output_len = base62_encode_into(input, len, output, base62_encoded_len(len));
+    if (output_len == BASE_ERROR) {
+        perror("Ошибка выделения памяти для результата");
+        return NULL;
+    }
+    output[output_len] = '\0';  // Завершаем строку
+
+    return output;
+}
+
+
+
+// Функция длины результата блочного кодирования в систему счисления radix
+static size_t radix_blocked_encoded_len(size_t len, uint32_t radix) {
+    size_t length = len / RADIX_BLOCK_BYTES * radix_block_width(RADIX_BLOCK_BYTES, radix);
+    if (len % RADIX_BLOCK_BYTES) {
+        length += radix_block_width(len % RADIX_BLOCK_BYTES, radix);
+    }
+    return length;
+}
+
+
+
+// Функция блочного кодирования в систему счисления radix
+static size_t radix_blocked_encode(const unsigned char* input, size_t len, char* output, size_t cap,
+                                   uint32_t radix, const char* table) {
+/**
+ * @brief Кодирует вход независимыми блоками по RADIX_BLOCK_BYTES байтов
+ * 
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ * 
+ * @note Полный блок всегда даёт radix_block_width(RADIX_BLOCK_BYTES) цифр, последний неполный -
+ *       radix_block_width(остаток): по ширине последней группы декодер восстанавливает её длину
+ */
+    if (cap < radix_blocked_encoded_len(len, radix)) {
+        return BASE_ERROR;
+    }
+
+    size_t full_width = radix_block_width(RADIX_BLOCK_BYTES, radix);
+    size_t pos = 0;
+    size_t i = 0;
+
+    for (; i + RADIX_BLOCK_BYTES <= len; i += RADIX_BLOCK_BYTES) {
+        radix_block_to_chars(input + i, RADIX_BLOCK_BYTES, radix, table, output + pos, full_width);
+        pos += full_width;
+    }
+    if (i < len) {
+        size_t tail_width = radix_block_width(len - i, radix);
+        radix_block_to_chars(input + i, len - i, radix, table, output + pos, tail_width);
+        pos += tail_width;
+    }
+
+    return pos;
+}
+
+
+
+// Функция длины результата блочного кодирования base58
+size_t base58_blocked_encoded_len(size_t len) {
+/**
+ * @brief Возвращает точную длину результата base58_encode_blocked (без завершающего нуля)
+ */
+    return radix_blocked_encoded_len(len, 58);
+}
+
+
+
+// Функция блочного кодирования base58 в буфер вызывающего
+size_t base58_encode_blocked_into(const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в блочный Base58 без выделения памяти
+ * 
+ * @param cap Размер буфера (не меньше base58_blocked_encoded_len(len))
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ */
+    return radix_blocked_encode(input, len, output, cap, 58, base58_table);
+}
+
+
+
+// Функция блочного кодирования исходного файла base58 - алгоритмом
+char* base58_encode_blocked(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует данные в Base58 блоками по 32 байта (44 символа на блок)
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для результата (не меньше base58_blocked_encoded_len(len) + 1 байт).
+ * @return char* Указатель на закодированную строку.
+ * 
+ * @note В отличие от base58_encode, время и память линейны по длине входа, а блоки
+ *       кодируются независимо. Результат несовместим с обычным Base58.
+ * 
+ * @example
+ * unsigned char data[] = {0x00, 0xAB, 0xCD};
+ * char encoded[8];
+ * base58_encode_blocked(data, 3, encoded); // Результат: "11E5J" (3 байта - 5 цифр)
+ */
+    size_t output_len = radix_blocked_encode(input, len, output, base58_blocked_encoded_len(len), 58, base58_table);
+    output[output_len] = '\0';  // Завершаем строку
+    return output;
+}
+
+
+
+// Функция длины результата блочного кодирования base62
+size_t base62_blocked_encoded_len(size_t len) {
+/**
+ * @brief Возвращает точную длину результата base62_encode_blocked (без завершающего нуля)
+ */
+    return radix_blocked_encoded_len(len, 62);
+}
+
+
+
+// Функция блочного кодирования base62 в буфер вызывающего
+size_t base62_encode_blocked_into(const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в блочный Base62 без выделения памяти
+ * 
+ * @param cap Размер буфера (не меньше base62_blocked_encoded_len(len))
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ */
+    return radix_blocked_encode(input, len, output, cap, 62, base62_table);
+}
+
+
+
+// Функция блочного кодирования исходного файла base62 - алгоритмом
+char* base62_encode_blocked(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует данные в Base62 блоками по 32 байта (43 символа на блок)
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для результата (не меньше base62_blocked_encoded_len(len) + 1 байт).
+ * @return char* Указатель на закодированную строку.
+ * 
+ * @note Время и память линейны по длине входа; результат несовместим с обычным Base62.
+ */
+    size_t output_len = radix_blocked_encode(input, len, output, base62_blocked_encoded_len(len), 62, base62_table);
+    output[output_len] = '\0';  // Завершаем строку
+    return output;
+}
+
+
+
+#ifdef CPU_ARM64
+// Функция кодирования блоками по 48 байт (NEON)
+static size_t base64_encode_neon(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 48 байт в 64 символа Base64 за итерацию
+ * 
+ * @return size_t Количество обработанных байтов (кратно 48), остаток кодирует скалярный код
+ * 
+ * @note vld3 раскладывает байты групп по трём регистрам, tbl по 64-байтной таблице
+ *       переводит индексы в символы, vst4 чередует их обратно
+ */
+    uint8x16x4_t table;
+    table.val[0] = vld1q_u8((const uint8_t*)base64_table);
+    table.val[1] = vld1q_u8((const uint8_t*)base64_table + 16);
+    table.val[2] = vld1q_u8((const uint8_t*)base64_table + 32);
+    table.val[3] = vld1q_u8((const uint8_t*)base64_table + 48);
+    const uint8x16_t mask = vdupq_n_u8(0x3F);
+    size_t i = 0, j = 0;
+
+    for (; len - i >= 48; i += 48, j += 64) {
+        const uint8x16x3_t in = vld3q_u8(input + i);
+        uint8x16x4_t chars;
+        chars.val[0] = vqtbl4q_u8(table, vshrq_n_u8(in.val[0], 2));
+        chars.val[1] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask));
+        chars.val[2] = vqtbl4q_u8(table, vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask));
+        chars.val[3] = vqtbl4q_u8(table, vandq_u8(in.val[2], mask));
+        vst4q_u8((uint8_t*)output + j, chars);
+    }
+    return i;
+}
+#endif
+
+
+
+#ifdef CPU_X86
+// Функция преобразования 6-битных индексов в символы Base64 (SSSE3)
+__attribute__((target("ssse3")))
+static inline __m128i base64_lookup_ssse3(__m128i indices) {
+/**
+ * @brief Переводит 16 индексов (0-63) в символы алфавита Base64 без обращения к таблице
+ * 
+ * @note Каждый индекс относится к одному из 5 диапазонов алфавита: номер диапазона
+ *       вычисляется арифметически, а смещение до ASCII-кода берётся через pshufb
+ */
+    // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    range = _mm_or_si128(range, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+    const __m128i shift_lut = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(shift_lut, range));
+}
+
+
+
+// Функция кодирования блоками по 12 байт (SSSE3)
+__attribute__((target("ssse3")))
+static size_t base64_encode_ssse3(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 12 байт в 16 символов Base64 за итерацию
+ * 
+ * @return size_t Количество обработанных байтов (кратно 3), остаток кодирует скалярный код
+ * 
+ * @note Загрузка читает 16 байт, поэтому цикл останавливается за 4 байта до конца входа
+ */
+    const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    size_t i = 0, j = 0;
+
+    for (; len - i >= 16; i += 12, j += 16) {
+        // Каждые 3 байта раскладываем в 32-битное слово [b1 b0 b2 b1]
+        __m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(input + i)), shuffle);
+
+        // Выделяем четыре 6-битных поля в отдельные байты умножениями вместо сдвигов
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+        _mm_storeu_si128((__m128i*)(output + j), base64_lookup_ssse3(_mm_or_si128(t1, t3)));
+    }
+    return i;
+}
+
+
+
+// Функция преобразования 6-битных индексов в символы Base64 (AVX2)
+__attribute__((target("avx2")))
+static inline __m256i base64_lookup_avx2(__m256i indices) {
+/**
+ * @brief 256-битный вариант base64_lookup_ssse3
+ */
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    range = _mm256_or_si256(range, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+    const __m256i shift_lut = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+        '/' - 63, 'A', 0, 0);
+    return _mm256_add_epi8(indices, _mm256_shuffle_epi8(shift_lut, range));
+}
+
+
+
+// Функция кодирования блоками по 24 байта (AVX2)
+__attribute__((target("avx2")))
+static size_t base64_encode_avx2(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 24 байта в 32 символа Base64 за итерацию
+ * 
+ * @return size_t Количество обработанных байтов (кратно 3), остаток кодирует скалярный код
+ * 
+ * @note Каждая 128-битная половина регистра получает свои 12 байт отдельной загрузкой
+ */
+    const __m256i shuffle = _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    size_t i = 0, j = 0;
+
+    for (; len - i >= 28; i += 24, j += 32) {
+        const __m128i lo = _mm_loadu_si128((const __m128i*)(input + i));
+        const __m128i hi = _mm_loadu_si128((const __m128i*)(input + i + 12));
+        __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        in = _mm256_shuffle_epi8(in, shuffle);
+
+        const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+        const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+        const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+        _mm256_storeu_si256((__m256i*)(output + j), base64_lookup_avx2(_mm256_or_si256(t1, t3)));
+    }
+    return i;
+}
+
+
+
+// Функция кодирования блоками по 48 байт (AVX-512 VBMI)
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static size_t base64_encode_vbmi(const unsigned char* input, size_t len, char* output) {
+/**
+ * @brief Кодирует 48 байт в 64 символа Base64 за итерацию
+ * 
+ * @return size_t Количество обработанных байтов - все полные группы по 3 байта
+ * 
+ * @note vpmultishiftqb выделяет 6-битные поля, vpermb переводит их в символы
+ * @note Хвост загружается и записывается по маске, скалярному коду остаётся только
+ *       неполная группа с дополнением '='
+ */
+    // Каждое 32-битное слово получает байты группы в порядке b1 b0 b2 b1
+    const __m512i shuffle = _mm512_setr_epi32(
+        0x01020001, 0x04050304, 0x07080607, 0x0A0B090A, 0x0D0E0C0D, 0x10110F10, 0x13141213, 0x16171516,
+        0x191A1819, 0x1C1D1B1C, 0x1F201E1F, 0x22232122, 0x25262425, 0x28292728, 0x2B2C2A2B, 0x2E2F2D2E);
+    const __m512i shifts = _mm512_set1_epi64(0x3036242A1016040ALL);
+    const __m512i lookup = _mm512_loadu_si512((const void*)base64_table);
+    size_t i = 0, j = 0;
+
+    while (len - i >= 3) {
+        const size_t n = (len - i >= 48) ? 48 : (len - i) / 3 * 3;
+        const __mmask64 in_mask = ((__mmask64)1 << n) - 1;
+        const __mmask64 out_mask = (n == 48) ? ~(__mmask64)0 : ((__mmask64)1 << (n / 3 * 4)) - 1;
+
+        const __m512i in = _mm512_permutexvar_epi8(shuffle, _mm512_maskz_loadu_epi8(in_mask, input + i));
+        const __m512i indices = _mm512_multishift_epi64_epi8(shifts, in);
+        _mm512_mask_storeu_epi8(output + j, out_mask, _mm512_permutexvar_epi8(indices, lookup));
+        i += n;
+        j += n / 3 * 4;
+    }
+    return i;
+}
+#endif
+
+
+
+// Функция длины результата кодирования base64
+size_t base64_encoded_len(size_t len) {
+/**
+ * @brief Возвращает точную длину строки Base64 для len байтов (с '=', без завершающего нуля)
+ */
+    return 4 * ((len + 2) / 3); // Каждые 3 байта кодируются в 4 символа
+}
+
+
+
+// Функция кодирования base64 в буфер вызывающего
+size_t base64_encode_into(const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в Base64 без выделения памяти
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для результата (завершающий ноль не пишется).
+ * @param cap Размер буфера (не меньше base64_encoded_len(len)).
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал.
+ * 
+ * @note Основная часть данных кодируется векторным ядром (AVX-512 VBMI, AVX2 или SSSE3), выбранным
+ *       по cpuid; скалярный цикл дописывает хвост и служит запасным вариантом.
+ */
+    if (cap < base64_encoded_len(len)) {
+        return BASE_ERROR;
+    }
+
+    size_t i = 0, j = 0;
+    uint32_t val;
+
+    const encode_kernels* kernels = encode_dispatch();
+    if (kernels->base64) {
+        i = kernels->base64(input, len, output);
+        j = i / 3 * 4;
+    }
+
+    // Полные группы по 3 байта
+    for (; len - i >= 3; i += 3) {
+        val = ((uint32_t)input[i] << 16) | ((uint32_t)input[i + 1] << 8) | input[i + 2];
+
+        // Разбиваем на 4 группы по 6 бит и кодируем в Base64
+        output[j++] = base64_table[(val >> 18) & 0x3F];
+        output[j++] = base64_table[(val >> 12) & 0x3F];
+        output[j++] = base64_table[(val >> 6) & 0x3F];
+        output[j++] = base64_table[val & 0x3F];
+    }
+
+    // Неполная последняя группа дополняется символами '='
+    if (i < len) {
+        val = (uint32_t)input[i] << 16;
+        if (i + 1 < len) {
+            val |= (uint32_t)input[i + 1] << 8;
+        }
+        output[j++] = base64_table[(val >> 18) & 0x3F];
+        output[j++] = base64_table[(val >> 12) & 0x3F];
+        output[j++] = (i + 1 < len) ? base64_table[(val >> 6) & 0x3F] : '=';
+        output[j++] = '=';
+    }
+
+    return j;
+}
+
+
+
+// Функция кодирования исходного файла base64 - алгоритмом --- РАБОТАЕТ
+char* base64_encode(const unsigned char* input, size_t len) {
+/**
+ * @brief Кодирует данные в формат Base64.
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @return char* Указатель на закодированную строку (нужно освободить через `free()`).
+ * 
+ * @note Дополнение '=' добавляется, если длина не кратна 3.
+ * @note Выделяет ровно base64_encoded_len(len) + 1 байт и кодирует через base64_encode_into.
+ * @warning Выделяет память внутри функции.
+ * 
+ * @example
+ * unsigned char data[] = {0xAB, 0xCD, 0xEF};
+ * char* encoded = base64_encode(data, 3); // Результат: "q83v"
+ * free(encoded);
+ */
+    // Вычисляем длину выходной строки
+    size_t output_len = base64_encoded_len(len);
+    char* output = (char*)malloc(output_len + 1); // +1 для завершающего нуля
+    if (!output) return NULL;
+
+    output[base64_encode_into(input, len, output, output_len)] = '\0'; // Завершаем строку
+    return output;
+}
+
+
+
+// Множитель для деления 32-битного числа на 85: v / 85 == (v * BASE85_RECIP) >> 38
+// (2^38 / 85 с округлением вверх; ошибка 21 * v < 2^38 для любого v < 2^32)
+#define BASE85_RECIP 3233857729u
+#define BASE85_SHIFT 38
+
+
+
+// Функция записи 32-битного значения пятью символами Base85
+static inline void base85_put_block(uint32_t value, char* output) {
+/**
+ * @brief Раскладывает значение на 5 цифр по основанию 85 (старшая первой)
+ * 
+ * @note Деление заменено умножением на обратную величину в фиксированной точке
+ */
+    for (int j = 4; j > 0; j--) {
+        uint32_t quotient = (uint32_t)(((uint64_t)value * BASE85_RECIP) >> BASE85_SHIFT);
+        output[j] = base85_table[value - quotient * 85];
+        value = quotient;
+    }
+    output[0] = base85_table[value];
+}
+
+
+
+#ifdef CPU_X86
+// Функция деления восьми 32-битных чисел на 85 (AVX2)
+__attribute__((target("avx2")))
+static inline __m256i base85_div85_avx2(__m256i value) {
+/**
+ * @brief Частное восьми беззнаковых чисел от деления на 85
+ * 
+ * @note vpmuludq умножает только чётные 32-битные элементы, поэтому нечётные
+ *       сдвигаются на их место и умножаются отдельно
+ */
+    const __m256i recip = _mm256_set1_epi32((int)BASE85_RECIP);
+    const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(value, recip), BASE85_SHIFT);
+    const __m256i odd = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(value, 32), recip), BASE85_SHIFT);
+    return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+}
+
+
+
+// Функция кодирования блоками по 32 байта (AVX2)
+__attribute__((target("avx2")))
+static size_t base85_encode_avx2(const unsigned char* input, size_t len, char* output, int options) {
+/**
+ * @brief Кодирует 8 групп по 4 байта в 40 символов Base85 за итерацию
+ * 
+ * @param options Флаги Ascii85: при ASCII85_RUNS ядро останавливается на блоке, где есть
+ *                нулевая группа (или группа из пробелов при ASCII85_SPACES) - её сокращает
+ *                скалярный код. Проверка - одно сравнение всего блока.
+ * @return size_t Количество обработанных байтов (кратно 32), остаток кодирует скалярный код
+ * 
+ * @note Цифры d0..d3 каждой группы собираются в одно 32-битное слово, d4 остаётся в младшем
+ *       байте своего слова. Каждая половина регистра даёт 20 символов: два pshufb по двум
+ *       источникам строят символы 0-15 и 4-19, которые записываются с перекрытием
+ */
+    const __m256i bswap = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    // Символ p половины: группа p / 5, цифра p % 5; цифры 0-3 из head, цифра 4 из tail
+    const __m256i head_lo = _mm256_setr_epi8(
+        0, 1, 2, 3, -1, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12,
+        0, 1, 2, 3, -1, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12);
+    const __m256i tail_lo = _mm256_setr_epi8(
+        -1, -1, -1, -1, 0, -1, -1, -1, -1, 4, -1, -1, -1, -1, 8, -1,
+        -1, -1, -1, -1, 0, -1, -1, -1, -1, 4, -1, -1, -1, -1, 8, -1);
+    const __m256i head_hi = _mm256_setr_epi8(
+        -1, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12, 13, 14, 15, -1,
+        -1, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12, 13, 14, 15, -1);
+    const __m256i tail_hi = _mm256_setr_epi8(
+        0, -1, -1, -1, -1, 4, -1, -1, -1, -1, 8, -1, -1, -1, -1, 12,
+        0, -1, -1, -1, -1, 4, -1, -1, -1, -1, 8, -1, -1, -1, -1, 12);
+    const __m256i base85 = _mm256_set1_epi32(85);
+    const __m256i first_char = _mm256_set1_epi8('!');
+    size_t i = 0, o = 0;
+
+    for (; len - i >= 32; i += 32, o += 40) {
+        const __m256i block = _mm256_loadu_si256((const __m256i*)(input + i));
+        if (options & ASCII85_RUNS) {
+            __m256i special = _mm256_cmpeq_epi32(block, _mm256_setzero_si256());
+            if (options & ASCII85_SPACES) {
+                special = _mm256_or_si256(special, _mm256_cmpeq_epi32(block, _mm256_set1_epi8(' ')));
+            }
+            if (!_mm256_testz_si256(special, special)) {
+                break;
+            }
+        }
+        __m256i value = _mm256_shuffle_epi8(block, bswap);
+
+        // Младшие цифры d4, d3, d2, d1; оставшееся частное и есть d0 (< 85)
+        __m256i quotient = base85_div85_avx2(value);
+        const __m256i d4 = _mm256_sub_epi32(value, _mm256_mullo_epi32(quotient, base85));
+        value = quotient;
+        quotient = base85_div85_avx2(value);
+        const __m256i d3 = _mm256_sub_epi32(value, _mm256_mullo_epi32(quotient, base85));
+        value = quotient;
+        quotient = base85_div85_avx2(value);
+        const __m256i d2 = _mm256_sub_epi32(value, _mm256_mullo_epi32(quotient, base85));
+        value = quotient;
+        quotient = base85_div85_avx2(value);
+        const __m256i d1 = _mm256_sub_epi32(value, _mm256_mullo_epi32(quotient, base85));
+
+        const __m256i head = _mm256_or_si256(
+            _mm256_or_si256(quotient, _mm256_slli_epi32(d1, 8)),
+            _mm256_or_si256(_mm256_slli_epi32(d2, 16), _mm256_slli_epi32(d3, 24)));
+        const __m256i lo = _mm256_add_epi8(first_char, _mm256_or_si256(
+            _mm256_shuffle_epi8(head, head_lo), _mm256_shuffle_epi8(d4, tail_lo)));
+        const __m256i hi = _mm256_add_epi8(first_char, _mm256_or_si256(
+            _mm256_shuffle_epi8(head, head_hi), _mm256_shuffle_epi8(d4, tail_hi)));
+
+        _mm_storeu_si128((__m128i*)(output + o), _mm256_castsi256_si128(lo));
+        _mm_storeu_si128((__m128i*)(output + o + 4), _mm256_castsi256_si128(hi));
+        _mm_storeu_si128((__m128i*)(output + o + 20), _mm256_extracti128_si256(lo, 1));
+        _mm_storeu_si128((__m128i*)(output + o + 24), _mm256_extracti128_si256(hi, 1));
+    }
+    return i;
+}
+#endif
+
+
+
+// Функция длины результата кодирования base85
+size_t base85_encoded_len(size_t len) {
+/**
+ * @brief Возвращает точную длину строки Base85 для len байтов (без завершающего нуля)
+ * 
+ * @note Неполная последняя группа дополняется до 5 символов
+ */
+    return ((len + 3) / 4) * 5;
+}
+
+
+
+// Функция кодирования base85 в буфер вызывающего
+size_t base85_encode_into(const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в Base85 без выделения памяти
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param output Буфер для результата (завершающий ноль не пишется).
+ * @param cap Размер буфера (не меньше base85_encoded_len(len)).
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал.
+ * 
+ * @note Деления на 85 заменены умножением на обратную величину; при поддержке AVX2
+ *       основная часть кодируется по 8 групп за итерацию сразу в выходной буфер.
+ */
+    if (cap < base85_encoded_len(len)) {
+        return BASE_ERROR;
+    }
+
+    size_t i = 0;
+
+    const encode_kernels* kernels = encode_dispatch();
+    if (kernels->base85) {
+        i = kernels->base85(input, len, output, 0);
+    }
+
+    char* ptr = output + i / 4 * 5;
+
+    // Полные группы по 4 байта
+    for (; len - i >= 4; i += 4) {
+        uint32_t value = ((uint32_t)input[i] << 24) | ((uint32_t)input[i + 1] << 16) |
+                         ((uint32_t)input[i + 2] << 8) | input[i + 3];
+        base85_put_block(value, ptr);
+        ptr += 5;
+    }
+
+    // Неполная последняя группа дополняется нулями
+    if (i < len) {
         uint32_t value = 0;
-        size_t block_size = (len - i > 4) ? 4 : len - i;
-        for (size_t j = 0; j < block_size; j++) {
-            value = (value << 8) | input[i + j];
+        for (size_t j = 0; j < 4; j++) {
+            value = (value << 8) | (i + j < len ? input[i + j] : 0);
+        }
+        base85_put_block(value, ptr);
+        ptr += 5;
+    }
+
+    return (size_t)(ptr - output);
+}
+
+
+
+// Функция кодирования исходного файла base85 - алгоритмом --- РАБОТАЕТ
+char* base85_encode(const unsigned char* input, size_t len) {
+/**
+ * @brief Кодирует данные в формат Base85 (используется в PDF и PostScript).
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @return char* Указатель на закодированную строку (нужно освободить через `free()`).
+ * 
+ * @note Каждые 4 байта кодируются в 5 символов; неполная последняя группа дополняется нулями.
+ * @note Выделяет ровно base85_encoded_len(len) + 1 байт и кодирует через base85_encode_into.
+ * @warning Выделяет память внутри функции.
+ */
+    // Вычисляем размер выходного буфера
+    size_t output_len = base85_encoded_len(len);
+    char* output = (char*)malloc(output_len + 1); // +1 для завершающего нуля
+    if (!output) {
+        perror("Ошибка выделения памяти для результата");
+        return NULL;
+    }
+
+    // Добавляем завершающий ноль
+    output[base85_encode_into(input, len, output, output_len)] = '\0';
+
+    return output;
+}
+
+
+
+// Функция длины результата кодирования ascii85
+size_t ascii85_encoded_len(size_t len, int options) {
+/**
+ * @brief Возвращает верхнюю оценку длины строки Ascii85 для len байтов (без завершающего нуля)
+ * 
+ * @note Оценка точна для данных без нулевых групп (и групп пробелов с ASCII85_SPACES):
+ *       каждая такая группа сокращает результат на 4 символа
+ */
+    size_t length = (len / 4) * 5 + (len % 4 ? len % 4 + 1 : 0);
+    if (options & ASCII85_FRAME) {
+        length += 4;
+    }
+    return length;
+}
+
+
+
+// Функция кодирования ascii85 в буфер вызывающего
+size_t ascii85_encode_into(const unsigned char* input, size_t len, int options, char* output, size_t cap) {
+/**
+ * @brief Кодирует данные в Ascii85 (Adobe) без выделения памяти
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param options Флаги ASCII85_FRAME и ASCII85_SPACES (см. ascii85_encode).
+ * @param output Буфер для результата (завершающий ноль не пишется).
+ * @param cap Размер буфера (не меньше ascii85_encoded_len(len, options)).
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал.
+ * 
+ * @note Векторное ядро проверяет блок из 8 групп одним сравнением и уступает блок
+ *       скалярному коду, только если в нём есть сокращаемая группа.
+ */
+    if (cap < ascii85_encoded_len(len, options)) {
+        return BASE_ERROR;
+    }
+
+    int runs = ASCII85_RUNS | (options & ASCII85_SPACES);
+    const encode_kernels* kernels = encode_dispatch();
+    char* ptr = output;
+    size_t i = 0;
+
+    if (options & ASCII85_FRAME) {
+        *ptr++ = '<';
+        *ptr++ = '~';
+    }
+
+    while (len - i >= 4) {
+        if (kernels->base85) {
+            size_t done = kernels->base85(input + i, len - i, ptr, runs);
+            i += done;
+            ptr += done / 4 * 5;
         }
-        for (size_t j = block_size; j < 4; j++) {
-            value <<= 8; // Дополняем нулями
+        // Блок с сокращаемыми группами (или весь вход без ядра) - скалярно, до 8 групп
+        for (int g = 0; g < 8 && len - i >= 4; g++, i += 4) {
+            uint32_t value = ((uint32_t)input[i] << 24) | ((uint32_t)input[i + 1] << 16) |
+                             ((uint32_t)input[i + 2] << 8) | input[i + 3];
+            if (value == 0) {
+                *ptr++ = 'z';
+            } else if ((options & ASCII85_SPACES) && value == 0x20202020u) {
+                *ptr++ = 'y';
+            } else {
+                base85_put_block(value, ptr);
+                ptr += 5;
+            }
         }
+    }
 
-        // Кодируем значение в 5 символов Base85
-        char block[5];
-        for (int j = 4; j >= 0; j--) {
-            block[j] = base85_table[value % 85];
-            value /= 85;
+    // Неполная последняя группа: r байт -> r + 1 символ
+    if (i < len) {
+        size_t rest = len - i;
+        uint32_t value = 0;
+        for (size_t j = 0; j < 4; j++) {
+            value = (value << 8) | (j < rest ? input[i + j] : 0);
         }
+        char block[5];
+        base85_put_block(value, block);
+        memcpy(ptr, block, rest + 1);
+        ptr += rest + 1;
+    }
 
-        // Копируем закодированный блок в выходной буфер
-        memcpy(ptr, block, 5);
-        ptr += 5;
+    if (options & ASCII85_FRAME) {
+        *ptr++ = '~';
+        *ptr++ = '>';
     }
 
-    // Добавляем завершающий ноль (если нужно)
-    *ptr = '\0';
+    return (size_t)(ptr - output);
+}
+
+
+
+// Функция кодирования исходного файла ascii85 - алгоритмом
+char* ascii85_encode(const unsigned char* input, size_t len, int options) {
+/**
+ * @brief Кодирует данные в формат Ascii85 (Adobe): Base85 с сокращениями и рамкой
+ * 
+ * @param input Указатель на входные данные.
+ * @param len Длина входных данных в байтах.
+ * @param options Флаги: ASCII85_FRAME - обрамить результат "<~" и "~>",
+ *                ASCII85_SPACES - кодировать группу из четырёх пробелов символом 'y'
+ *                (расширение btoa, не входит в стандарт Adobe)
+ * @return char* Указатель на закодированную строку (нужно освободить через `free()`).
+ * 
+ * @note Нулевая группа кодируется символом 'z'. Неполная последняя группа из r байт
+ *       дополняется нулями, а из 5 символов записываются только первые r + 1.
+ * @note Кодирует через ascii85_encode_into в буфер по верхней оценке длины.
+ * @warning Выделяет память внутри функции.
+ * 
+ * @example
+ * unsigned char data[] = {0, 0, 0, 0, 'A'};
+ * char* encoded = ascii85_encode(data, 5, ASCII85_FRAME); // Результат: "<~z5l~>"
+ * free(encoded);
+ */
+    size_t output_len = ascii85_encoded_len(len, options);
+    char* output = (char*)malloc(output_len + 1);
+    if (!output) {
+        perror("Ошибка выделения памяти для результата");
+        return NULL;
+    }
+
+    output[ascii85_encode_into(input, len, options, output, output_len)] = '\0';
 
     return output;
-}
\ No newline at end of file
+}
+
+
+
+// Функция потокового кодирования очередного фрагмента
+static size_t stream_encode_update(base_enc_state* state, const unsigned char* input, size_t len,
+                                   char* output, size_t cap, size_t group,
+                                   size_t (*encode)(const unsigned char*, size_t, char*, size_t),
+                                   size_t (*encoded_len)(size_t)) {
+/**
+ * @brief Общая часть baseN_enc_update: кодирует все полные группы из перенесённой
+ *        неполной группы и нового фрагмента, остаток сохраняет в state
+ * 
+ * @param group Размер входной группы кодека в байтах (1, 3, 4 или 5)
+ * @return size_t Количество записанных символов или BASE_ERROR (состояние не меняется)
+ * 
+ * @note Границы групп совпадают с границами при кодировании всего входа сразу,
+ *       поэтому результат потока побайтно равен результату baseN_encode_into
+ */
+    size_t total = state->carry_len + len;
+    if (cap < encoded_len(total / group * group)) {
+        return BASE_ERROR;
+    }
+
+    size_t written = 0;
+    size_t used = 0;
+
+    // Дополняем перенесённую группу и кодируем её, если она собралась целиком
+    if (state->carry_len > 0) {
+        used = group - state->carry_len;
+        if (used > len) {
+            used = len;
+        }
+        memcpy(state->carry + state->carry_len, input, used);
+        state->carry_len += used;
+        if (state->carry_len < group) {
+            return 0;
+        }
+        written = encode(state->carry, group, output, cap);
+        state->carry_len = 0;
+    }
+
+    // Полные группы фрагмента кодируются прямо из входа
+    size_t full = (len - used) / group * group;
+    written += encode(input + used, full, output + written, cap - written);
+    used += full;
+
+    memcpy(state->carry, input + used, len - used);
+    state->carry_len = len - used;
+    return written;
+}
+
+
+
+// Функция завершения потокового кодирования
+static size_t stream_encode_final(base_enc_state* state, char* output, size_t cap,
+                                  size_t (*encode)(const unsigned char*, size_t, char*, size_t)) {
+/**
+ * @brief Общая часть baseN_enc_final: кодирует оставшуюся неполную группу как хвост входа
+ */
+    size_t written = encode(state->carry, state->carry_len, output, cap);
+    if (written != BASE_ERROR) {
+        state->carry_len = 0;
+    }
+    return written;
+}
+
+
+
+// Функция начала потокового кодирования base16
+void base16_enc_init(base_enc_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового кодирования
+ */
+    state->carry_len = 0;
+}
+
+
+
+// Функция потокового кодирования фрагмента base16
+size_t base16_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует очередной фрагмент в Base16 (группа - 1 байт, переноса нет)
+ * 
+ * @param state Состояние, подготовленное base16_enc_init
+ * @param output Буфер для результата (завершающий ноль не пишется)
+ * @param cap Размер буфера (не меньше base16_encoded_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных символов или BASE_ERROR
+ */
+    return stream_encode_update(state, input, len, output, cap, 1, base16_encode_into, base16_encoded_len);
+}
+
+
+
+// Функция завершения потокового кодирования base16
+size_t base16_enc_final(base_enc_state* state, char* output, size_t cap) {
+/**
+ * @brief Дописывает хвост потока Base16 (для Base16 он всегда пуст)
+ */
+    return stream_encode_final(state, output, cap, base16_encode_into);
+}
+
+
+
+// Функция начала потокового кодирования base32
+void base32_enc_init(base_enc_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового кодирования
+ */
+    state->carry_len = 0;
+}
+
+
+
+// Функция потокового кодирования фрагмента base32
+size_t base32_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует очередной фрагмент в Base32 группами по 5 байт
+ * 
+ * @param state Состояние, подготовленное base32_enc_init
+ * @param output Буфер для результата (завершающий ноль не пишется)
+ * @param cap Размер буфера (не меньше base32_encoded_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных символов или BASE_ERROR
+ * 
+ * @note До 4 байт неполной группы переносятся в следующий вызов
+ */
+    return stream_encode_update(state, input, len, output, cap, 5, base32_encode_into, base32_encoded_len);
+}
+
+
+
+// Функция завершения потокового кодирования base32
+size_t base32_enc_final(base_enc_state* state, char* output, size_t cap) {
+/**
+ * @brief Дописывает неполную последнюю группу Base32 (до 7 символов, без '=')
+ */
+    return stream_encode_final(state, output, cap, base32_encode_into);
+}
+
+
+
+// Функция начала потокового кодирования base64
+void base64_enc_init(base_enc_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового кодирования
+ */
+    state->carry_len = 0;
+}
+
+
+
+// Функция потокового кодирования фрагмента base64
+size_t base64_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует очередной фрагмент в Base64 группами по 3 байта
+ * 
+ * @param state Состояние, подготовленное base64_enc_init
+ * @param output Буфер для результата (завершающий ноль не пишется)
+ * @param cap Размер буфера (не меньше base64_encoded_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных символов или BASE_ERROR
+ * 
+ * @note До 2 байт неполной группы переносятся в следующий вызов
+ */
+    return stream_encode_update(state, input, len, output, cap, 3, base64_encode_into, base64_encoded_len);
+}
+
+
+
+// Функция завершения потокового кодирования base64
+size_t base64_enc_final(base_enc_state* state, char* output, size_t cap) {
+/**
+ * @brief Дописывает неполную последнюю группу Base64 с дополнением '=' (4 символа)
+ */
+    return stream_encode_final(state, output, cap, base64_encode_into);
+}
+
+
+
+// Функция начала потокового кодирования base85
+void base85_enc_init(base_enc_state* state) {
+/**
+ * @brief Сбрасывает состояние потокового кодирования
+ */
+    state->carry_len = 0;
+}
+
+
+
+// Функция потокового кодирования фрагмента base85
+size_t base85_enc_update(base_enc_state* state, const unsigned char* input, size_t len, char* output, size_t cap) {
+/**
+ * @brief Кодирует очередной фрагмент в Base85 группами по 4 байта
+ * 
+ * @param state Состояние, подготовленное base85_enc_init
+ * @param output Буфер для результата (завершающий ноль не пишется)
+ * @param cap Размер буфера (не меньше base85_encoded_len(len) + BASE_STREAM_SLACK)
+ * @return size_t Количество записанных символов или BASE_ERROR
+ * 
+ * @note До 3 байт неполной группы переносятся в следующий вызов
+ */
+    return stream_encode_update(state, input, len, output, cap, 4, base85_encode_into, base85_encoded_len);
+}
+
+
+
+// Функция завершения потокового кодирования base85
+size_t base85_enc_final(base_enc_state* state, char* output, size_t cap) {
+/**
+ * @brief Дописывает неполную последнюю группу Base85, дополненную нулями до 5 символов
+ */
+    return stream_encode_final(state, output, cap, base85_encode_into);
+}
+
+
+
+// Контекст параллельного кодирования
+typedef struct {
+    const unsigned char* input;
+    size_t len;
+    char* output;
+    size_t piece;  // байт входа на задачу (кратно размеру группы)
+    size_t (*encode)(const unsigned char*, size_t, char*, size_t);
+    size_t (*encoded_len)(size_t);
+} parallel_encode_ctx;
+
+
+
+// Функция кодирования одной части входа
+static void parallel_encode_task(void* arg, size_t index) {
+/**
+ * @brief Кодирует часть index в её участок выхода
+ * 
+ * @note Часть начинается на границе группы, поэтому её результат начинается ровно
+ *       с encoded_len(начало части) и не пересекается с соседними
+ */
+    const parallel_encode_ctx* ctx = (const parallel_encode_ctx*)arg;
+    size_t start = index * ctx->piece;
+    size_t n = ctx->len - start < ctx->piece ? ctx->len - start : ctx->piece;
+    ctx->encode(ctx->input + start, n, ctx->output + ctx->encoded_len(start), ctx->encoded_len(n));
+}
+
+
+
+// Функция параллельного кодирования
+static size_t parallel_encode(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool,
+                              size_t group, size_t (*encode)(const unsigned char*, size_t, char*, size_t),
+                              size_t (*encoded_len)(size_t)) {
+/**
+ * @brief Общая часть baseN_encode_parallel
+ * 
+ * @param group Размер входной группы кодека в байтах
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ * 
+ * @note Вход делится примерно на 4 части на поток (чтобы потоки, закончившие раньше,
+ *       забрали остаток), но не мельче PARALLEL_MIN_CHUNK
+ */
+    if (cap < encoded_len(len)) {
+        return BASE_ERROR;
+    }
+
+    // Ядра выбираются до запуска потоков, а не наперегонки в них
+    encode_dispatch();
+
+    int threads = thread_pool_size(pool);
+    if (threads == 1 || len < 2 * PARALLEL_MIN_CHUNK) {
+        return encode(input, len, output, cap);
+    }
+
+    size_t piece = len / ((size_t)threads * 4);
+    if (piece < PARALLEL_MIN_CHUNK) {
+        piece = PARALLEL_MIN_CHUNK;
+    }
+    piece = (piece + group - 1) / group * group;
+
+    parallel_encode_ctx ctx = {input, len, output, piece, encode, encoded_len};
+    thread_pool_run(pool, (len + piece - 1) / piece, parallel_encode_task, &ctx);
+    return encoded_len(len);
+}
+
+
+
+// Функция параллельного кодирования base16
+size_t base16_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool) {
+/**
+ * @brief Кодирует данные в Base16 на пуле потоков
+ * 
+ * @param cap Размер буфера (не меньше base16_encoded_len(len))
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ */
+    return parallel_encode(input, len, output, cap, pool, 1, base16_encode_into, base16_encoded_len);
+}
+
+
+
+// Функция параллельного кодирования base32
+size_t base32_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool) {
+/**
+ * @brief Кодирует данные в Base32 на пуле потоков (части кратны 5 байтам)
+ * 
+ * @param cap Размер буфера (не меньше base32_encoded_len(len))
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ */
+    return parallel_encode(input, len, output, cap, pool, 5, base32_encode_into, base32_encoded_len);
+}
+
+
+
+// Функция параллельного кодирования base64
+size_t base64_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool) {
+/**
+ * @brief Кодирует данные в Base64 на пуле потоков (части кратны 3 байтам)
+ * 
+ * @param cap Размер буфера (не меньше base64_encoded_len(len))
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ */
+    return parallel_encode(input, len, output, cap, pool, 3, base64_encode_into, base64_encoded_len);
+}
+
+
+
+// Функция параллельного кодирования base85
+size_t base85_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool) {
+/**
+ * @brief Кодирует данные в Base85 на пуле потоков (части кратны 4 байтам)
+ * 
+ * @param cap Размер буфера (не меньше base85_encoded_len(len))
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных символов или BASE_ERROR, если буфер мал
+ */
+    return parallel_encode(input, len, output, cap, pool, 4, base85_encode_into, base85_encoded_len);
+}
+
+
+
+// Функция параллельного кодирования base58
+size_t base58_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool) {
+/**
+ * @brief Кодирует данные в Base58 на пуле потоков (результат тот же, что у base58_encode_into)
+ * 
+ * @param cap Размер буфера (base58_encoded_len(len) достаточно всегда)
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных символов или BASE_ERROR (буфер мал, нет памяти)
+ * 
+ * @note Вход - одно большое число, поэтому делится не вход, а рекурсивный перевод в radix.c:
+ *       поддеревья переводятся параллельно, умножения верхних уровней делят NTT между потоками
+ */
+    size_t zeros = 0;
+    while (zeros < len && input[zeros] == 0) {
+        zeros++;
+    }
+    return radix_encode_into(input + zeros, len - zeros, output, cap, 58, base58_table, zeros, pool);
+}
+
+
+
+// Функция параллельного кодирования base62
+size_t base62_encode_parallel(const unsigned char* input, size_t len, char* output, size_t cap, thread_pool* pool) {
+/**
+ * @brief Кодирует данные в Base62 на пуле потоков (результат тот же, что у base62_encode_into)
+ * 
+ * @param cap Размер буфера (base62_encoded_len(len) достаточно всегда)
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество записанных символов или BASE_ERROR (буфер мал, нет памяти)
+ */
+    return radix_encode_into(input, len, output, cap, 62, base62_table, 0, pool);
+}
+
+
+
+// Таблица ядер кодирования, заполняемая один раз за процесс
+static encode_kernels encode_table;
+#ifdef ENCODE_POSIX
+static pthread_once_t encode_once = PTHREAD_ONCE_INIT;
+#else
+static int encode_resolved = 0;
+#endif
+
+
+
+// Функция заполнения таблицы ядер кодирования
+static void encode_resolve(void) {
+/**
+ * @brief Связывает точки входа с лучшими ядрами для текущего процессора
+ * 
+ * @note Выбор выполняется по cpu_features() (с учётом ограничения BASE_CPU)
+ */
+#if defined(CPU_X86) || defined(CPU_ARM64)
+    unsigned int features = cpu_features();
+#endif
+
+    // 64-битные SWAR-ядра работают везде и заменяются векторными, если те доступны.
+    // Для Base64 табличный скалярный цикл быстрее SWAR-перевода индексов в символы
+    encode_table.base16 = base16_encode_swar;
+    encode_table.base32 = base32_encode_swar;
+
+#ifdef CPU_ARM64
+    if (features & CPU_NEON) {
+        encode_table.base16 = base16_encode_neon;
+        encode_table.base32 = base32_encode_neon;
+        encode_table.base64 = base64_encode_neon;
+    }
+#endif
+
+#ifdef CPU_X86
+    if (features & CPU_AVX2) {
+        encode_table.base16 = base16_encode_avx2;
+        encode_table.base32 = base32_encode_avx2;
+        encode_table.base64 = base64_encode_avx2;
+        encode_table.base85 = base85_encode_avx2;
+    } else if (features & CPU_SSSE3) {
+        encode_table.base16 = base16_encode_ssse3;
+        encode_table.base32 = base32_encode_ssse3;
+        encode_table.base64 = base64_encode_ssse3;
+    }
+    if (features & CPU_AVX512VBMI) {
+        encode_table.base32 = base32_encode_vbmi;
+        encode_table.base64 = base64_encode_vbmi;
+    }
+#endif
+}
+
+
+
+// Функция выбора векторных ядер кодирования
+static const encode_kernels* encode_dispatch(void) {
+/**
+ * @brief Возвращает таблицу ядер, при первом вызове заполняя её
+ * 
+ * @return const encode_kernels* Таблица ядер (одна на процесс)
+ * 
+ * @note С pthreads таблица заполняется через pthread_once, и первый вызов из нескольких
+ *       потоков сразу безопасен. Без pthreads собственный пул работает в одном потоке;
+ *       вызывающий, создающий потоки сам, должен сначала вызвать encode_kernels_init()
+ */
+#ifdef ENCODE_POSIX
+    pthread_once(&encode_once, encode_resolve);
+#else
+    if (!encode_resolved) {
+        encode_resolve();
+        encode_resolved = 1;
+    }
+#endif
+    return &encode_table;
+}
+
+
+
+// Функция заблаговременного выбора ядер кодирования
+void encode_kernels_init(void) {
+/**
+ * @brief Выбирает ядра кодирования в вызывающем потоке
+ * 
+ * @note С pthreads не обязательна (выбор защищён pthread_once); на платформах без
+ *       pthreads вызывается до запуска потоков, каждый из которых обращается к кодекам
+ */
+    encode_dispatch();
+}
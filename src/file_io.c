@@ -0,0 +1,449 @@
+/**
+ * @file file_io.c
+ * @brief Чтение входных файлов: отображение в память (mmap) с запасным вариантом через read()
+ * 
+ * @note Обычные файлы отображаются только для чтения и передаются кодекам без копирования.
+ *       Каналы, устройства и платформы без mmap читаются в буфер, растущий по мере чтения.
+ * @note Здесь же собирается список входных файлов пакетного режима (каталог или файл-список).
+ */
+
+#define _DEFAULT_SOURCE  // MAP_POPULATE и MADV_* при сборке с -std=c99
+
+#include "../include/file_io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FILE_IO_POSIX 1
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#endif
+
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#include <direct.h>
+#endif
+
+// Начальный размер буфера при чтении файла неизвестной длины
+#define FILE_READ_CHUNK ((size_t)64 << 10)
+
+// Наибольшая длина строки файла-списка (пути)
+#define FILE_LIST_LINE 4096
+
+
+
+#ifdef FILE_IO_POSIX
+// Функция отображения обычного файла в память
+static int map_file(int fd, size_t size, file_view* view) {
+/**
+ * @brief Отображает файл целиком только для чтения
+ * 
+ * @param fd Дескриптор открытого файла
+ * @param size Размер файла (больше нуля)
+ * @param view Структура для записи результата
+ * @return int 0 при успехе, -1 если отобразить не удалось
+ * 
+ * @note Файлы до FILE_POPULATE_LIMIT подгружаются сразу (MAP_POPULATE), чтобы не платить
+ *       за отдельный отказ страницы на каждые 4 КиБ; большие файлы подгружаются по мере
+ *       чтения, и объём входа не ограничен объёмом памяти
+ */
+    int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+    if (size <= FILE_POPULATE_LIMIT) {
+        flags |= MAP_POPULATE;
+    }
+#endif
+
+    void* data = mmap(NULL, size, PROT_READ, flags, fd, 0);
+    if (data == MAP_FAILED) {
+        return -1;
+    }
+
+    // Кодеки читают вход один раз от начала к концу
+    madvise(data, size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    if (size >= FILE_HUGEPAGE_SIZE) {
+        madvise(data, size, MADV_HUGEPAGE);
+    }
+#endif
+
+    view->data = (const unsigned char*)data;
+    view->size = size;
+    view->mapped = 1;
+    return 0;
+}
+#endif
+
+
+
+// Функция чтения потока целиком в буфер
+static int read_stream(FILE* file, size_t size_hint, file_view* view) {
+/**
+ * @brief Читает поток до конца в буфер malloc, увеличивая его по мере необходимости
+ * 
+ * @param file Открытый поток
+ * @param size_hint Ожидаемый размер (0, если неизвестен)
+ * @param view Структура для записи результата
+ * @return int 0 при успехе, -1 при ошибке чтения или выделения памяти
+ */
+    size_t capacity = size_hint ? size_hint + 1 : FILE_READ_CHUNK;
+    size_t size = 0;
+    unsigned char* buffer = (unsigned char*)malloc(capacity);
+    if (!buffer) {
+        return -1;
+    }
+
+    while (1) {
+        if (size == capacity) {
+            unsigned char* grown = (unsigned char*)realloc(buffer, capacity * 2);
+            if (!grown) {
+                free(buffer);
+                return -1;
+            }
+            buffer = grown;
+            capacity *= 2;
+        }
+        size_t got = fread(buffer + size, 1, capacity - size, file);
+        size += got;
+        if (got == 0) {
+            break;
+        }
+    }
+
+    if (ferror(file)) {
+        free(buffer);
+        return -1;
+    }
+
+    view->data = buffer;
+    view->size = size;
+    view->mapped = 0;
+    return 0;
+}
+
+
+
+// Функция открытия файла для чтения без копирования
+int file_view_open(const char* path, file_view* view) {
+/**
+ * @brief Открывает файл и предоставляет его содержимое только для чтения
+ * 
+ * @param path Путь к файлу ("-" - стандартный ввод)
+ * @param view Структура для записи результата (освобождается через file_view_close)
+ * @return int 0 при успехе, -1 при ошибке (сообщение выводится через perror)
+ * 
+ * @note Непустой обычный файл отображается в память; если это невозможно (канал,
+ *       устройство, пустой файл, ошибка mmap или платформа без mmap), файл читается в буфер
+ * @note Стандартный ввод, перенаправленный из обычного файла, тоже отображается, если
+ *       он стоит в начале файла; иначе читается с текущей позиции
+ * @warning Данные отображения доступны только для чтения
+ */
+    int standard_input = strcmp(path, "-") == 0;
+    FILE* file = standard_input ? stdin : fopen(path, "rb");
+    if (!file) {
+        perror("Error opening file");
+        return -1;
+    }
+#ifdef _WIN32
+    if (standard_input) {
+        _setmode(_fileno(stdin), _O_BINARY);
+    }
+#endif
+
+    size_t size_hint = 0;
+#ifdef FILE_IO_POSIX
+    struct stat st;
+    if (fstat(fileno(file), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        // Стандартный ввод мог быть уже частично прочитан до запуска (например, другим
+        // процессом той же оболочки): отображается только поток, стоящий в начале файла
+        long position = ftell(file);
+        size_hint = position > 0 && position < st.st_size ? (size_t)(st.st_size - position) : (size_t)st.st_size;
+        if (position == 0 && map_file(fileno(file), size_hint, view) == 0) {
+            if (!standard_input) {
+                fclose(file);
+            }
+            return 0;
+        }
+    }
+#else
+    if (!standard_input && fseek(file, 0, SEEK_END) == 0) {
+        long end = ftell(file);
+        size_hint = end > 0 ? (size_t)end : 0;
+        rewind(file);
+    }
+#endif
+
+    int result = read_stream(file, size_hint, view);
+    if (result != 0) {
+        perror("Error reading file");
+    }
+    if (!standard_input) {
+        fclose(file);
+    }
+    return result;
+}
+
+
+
+// Функция освобождения данных файла
+void file_view_close(file_view* view) {
+/**
+ * @brief Снимает отображение или освобождает буфер файла
+ * 
+ * @param view Структура, заполненная file_view_open
+ */
+    if (!view->data) {
+        return;
+    }
+#ifdef FILE_IO_POSIX
+    if (view->mapped) {
+        munmap((void*)view->data, view->size);
+    } else {
+        free((void*)view->data);
+    }
+#else
+    free((void*)view->data);
+#endif
+    view->data = NULL;
+    view->size = 0;
+}
+
+
+
+// Функция размера файла по пути
+static int file_size_of(const char* path, size_t* size, int* regular) {
+/**
+ * @brief Определяет размер файла и является ли он обычным файлом
+ * 
+ * @return int 0 при успехе, -1 если файл недоступен
+ */
+#ifdef FILE_IO_POSIX
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return -1;
+    }
+    *regular = S_ISREG(st.st_mode);
+    *size = *regular ? (size_t)st.st_size : 0;
+    return 0;
+#else
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        return -1;
+    }
+    long end = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+    fclose(file);
+    *regular = 1;
+    *size = end > 0 ? (size_t)end : 0;
+    return 0;
+#endif
+}
+
+
+
+// Функция добавления файла в список
+static int file_list_add(file_list* list, const char* path, size_t size) {
+/**
+ * @return int 0 при успехе, -1 при ошибке выделения памяти
+ */
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 64;
+        file_entry* entries = (file_entry*)realloc(list->entries, capacity * sizeof(file_entry));
+        if (!entries) {
+            return -1;
+        }
+        list->entries = entries;
+        list->capacity = capacity;
+    }
+
+    char* copy = (char*)malloc(strlen(path) + 1);
+    if (!copy) {
+        return -1;
+    }
+    strcpy(copy, path);
+    list->entries[list->count].path = copy;
+    list->entries[list->count].size = size;
+    list->count++;
+    return 0;
+}
+
+
+
+#ifdef FILE_IO_POSIX
+// Функция сбора обычных файлов каталога
+static int file_list_directory(const char* dir_path, file_list* list) {
+/**
+ * @brief Добавляет в список обычные файлы каталога (без обхода подкаталогов)
+ * 
+ * @return int 0 при успехе, -1 при ошибке
+ */
+    DIR* dir = opendir(dir_path);
+    if (!dir) {
+        perror("Error opening directory");
+        return -1;
+    }
+
+    size_t dir_len = strlen(dir_path);
+    int separator = dir_len > 0 && dir_path[dir_len - 1] != '/';
+    int result = 0;
+    struct dirent* entry;
+    while (result == 0 && (entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.' && (entry->d_name[1] == '\0' || strcmp(entry->d_name, "..") == 0)) {
+            continue;
+        }
+        char* path = (char*)malloc(dir_len + strlen(entry->d_name) + 2);
+        if (!path) {
+            result = -1;
+            break;
+        }
+        sprintf(path, "%s%s%s", dir_path, separator ? "/" : "", entry->d_name);
+
+        size_t size;
+        int regular;
+        if (file_size_of(path, &size, &regular) == 0 && regular) {
+            result = file_list_add(list, path, size);
+        }
+        free(path);
+    }
+    closedir(dir);
+    return result;
+}
+#endif
+
+
+
+// Функция проверки, является ли путь каталогом
+int file_is_directory(const char* path) {
+/**
+ * @return int 1 для каталога, 0 для файла, недоступного пути или платформы без stat
+ */
+#ifdef FILE_IO_POSIX
+    struct stat st;
+    return stat(path, &st) == 0 && S_ISDIR(st.st_mode);
+#else
+    (void)path;
+    return 0;
+#endif
+}
+
+
+
+// Функция создания каталога
+int file_make_directory(const char* path) {
+/**
+ * @brief Создаёт каталог (один уровень), если его ещё нет
+ * 
+ * @param path Путь к каталогу (завершающий '/' допускается)
+ * @return int 0, если каталог есть или создан, -1 при ошибке (причина - в errno)
+ */
+#if defined(FILE_IO_POSIX)
+    if (mkdir(path, 0777) == 0) {
+        return 0;
+    }
+    if (errno == EEXIST && file_is_directory(path)) {
+        return 0;
+    }
+    if (errno == EEXIST) {
+        errno = ENOTDIR;
+    }
+    return -1;
+#elif defined(_WIN32)
+    return _mkdir(path) == 0 || errno == EEXIST ? 0 : -1;
+#else
+    (void)path;
+    return 0;
+#endif
+}
+
+
+
+// Функция сбора входных файлов пакетного режима
+int file_list_open(const char* path, file_list* list) {
+/**
+ * @brief Собирает список входных файлов с их размерами
+ * 
+ * @param path Каталог (берутся его обычные файлы) или текстовый файл со списком путей,
+ *             по одному в строке (пустые строки пропускаются)
+ * @param list Структура для записи результата (освобождается через file_list_close)
+ * @return int 0 при успехе, -1 при ошибке
+ * 
+ * @note Недоступные пути и строки длиннее FILE_LIST_LINE сообщаются в stderr и не попадают
+ *       в список; их число записывается в list->skipped
+ */
+    list->entries = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    list->skipped = 0;
+
+#ifdef FILE_IO_POSIX
+    struct stat st;
+    if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+        if (file_list_directory(path, list) != 0) {
+            file_list_close(list);
+            return -1;
+        }
+        return 0;
+    }
+#endif
+
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        perror("Error opening file list");
+        return -1;
+    }
+
+    char line[FILE_LIST_LINE];
+    size_t line_number = 0;
+    int result = 0;
+    while (result == 0 && fgets(line, sizeof(line), file)) {
+        line_number++;
+        size_t length = strcspn(line, "\n");
+        if (line[length] != '\n' && !feof(file)) {
+            // Строка не поместилась в буфер: пропускаем её остаток, а не считаем его путём
+            int c;
+            while ((c = fgetc(file)) != EOF && c != '\n');
+            fprintf(stderr, "%s:%zu: path is too long (limit %d bytes)\n", path, line_number, FILE_LIST_LINE - 2);
+            list->skipped++;
+            continue;
+        }
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0') {
+            continue;
+        }
+        size_t size;
+        int regular;
+        if (file_size_of(line, &size, &regular) != 0) {
+            fprintf(stderr, "%s:%zu: ", path, line_number);
+            perror(line);
+            list->skipped++;
+            continue;
+        }
+        result = file_list_add(list, line, size);
+    }
+    fclose(file);
+
+    if (result != 0) {
+        file_list_close(list);
+    }
+    return result;
+}
+
+
+
+// Функция освобождения списка файлов
+void file_list_close(file_list* list) {
+    for (size_t i = 0; i < list->count; i++) {
+        free(list->entries[i].path);
+    }
+    free(list->entries);
+    list->entries = NULL;
+    list->count = 0;
+    list->capacity = 0;
+    list->skipped = 0;
+}
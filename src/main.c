@@ -5,10 +5,13 @@
  * @author Фёдор
  * @date 25.03.2025
  * 
- * @note Поддерживаемые форматы: Base16, Base32, Base58, Base62, Base64, Base85
+ * @note Поддерживаемые форматы: Base16, Base32, Base58, Base62, Base64, Base85,
+ *       а также блочные Base58/Base62 (расширения .base58b/.base62b) и Ascii85 (.ascii85)
  * @warning Для работы требуются заголовочные файлы decod_func.h, encod_func.h и tables.h
  */
 
+#define _POSIX_C_SOURCE 200809L  // strdup при сборке с -std=c99
+
 #define STB_IMAGE_IMPLEMENTATION
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #define ENCOD_FUNCTION
@@ -17,12 +20,23 @@
 #include "../include/decod_func.h"
 #include "../include/encod_func.h"
 #include "../include/tables.h"
+#include "../include/cpu_features.h"
+#include "../include/file_io.h"
+#include "../include/parallel.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
 
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+
+// Каталог для результатов, если выходной путь не задан
+#define OUTPUT_DIR "output/"
+
 
 // Функция для получения имени файла из пути
 const char* get_filename(const char* path) {
@@ -84,58 +98,104 @@ char* extension_definition(const char* name_input) {
 
 
 // Функция преобразования файла в битовую строку
-unsigned char* read_file_as_bytes(const char* filename, size_t* file_size) {
+const unsigned char* read_file_as_bytes(const char* filename, file_view* view) {
 /**
- * @brief Читает файл как массив байтов
+ * @brief Открывает файл для кодирования без копирования его содержимого
  * 
  * @param filename Имя файла
- * @param file_size Указатель для записи размера файла
- * @return unsigned char* Буфер с данными (нужно освободить) или NULL при ошибке
+ * @param view Структура для данных и размера файла (освободить через file_view_close)
+ * @return const unsigned char* Данные файла только для чтения или NULL при ошибке
  * 
- * @warning Выделяет память, которую нужно освободить через free()
+ * @note Обычный файл отображается в память, каналы и устройства читаются через read()
  */
-    FILE* file = fopen(filename, "rb");
-    if (!file) {
-        perror("Error opening file");
+    if (file_view_open(filename, view) != 0) {
         return NULL;
     }
-    
-    fseek(file, 0, SEEK_END);
-    *file_size = ftell(file);  // Получаем размер файла
-    rewind(file);
-    
-    // Выделяем память для данных файла
-    unsigned char* buffer = (unsigned char*)malloc(*file_size);
-    if (buffer == NULL) {
-        perror("Memory allocation error");
-        fclose(file);
-        return NULL;
+    return view->data;
+}
+
+
+
+// Названия и расширения алгоритмов кодирования по номеру в меню (1-9)
+static const char* const encoding_names[] = {
+    NULL, "Base16", "Base32", "Base58", "Base62", "Base64", "Base85",
+    "Base58 (blocked)", "Base62 (blocked)", "Ascii85"
+};
+static const char* const encoding_extensions[] = {
+    NULL, ".base16", ".base32", ".base58", ".base62", ".base64", ".base85",
+    ".base58b", ".base62b", ".ascii85"
+};
+
+// Функция поиска алгоритма по названию
+int encoding_by_name(const char* name) {
+/**
+ * @brief Переводит название алгоритма (расширение без точки: base64, base58b, ascii85...)
+ *        в номер меню
+ * 
+ * @param name Название алгоритма
+ * @return int Номер алгоритма (1-9) или 0, если название неизвестно
+ */
+    for (int choice = 1; choice <= 9; choice++) {
+        if (strcmp(name, encoding_extensions[choice] + 1) == 0) {
+            return choice;
+        }
     }
-    
-    // Чтение файла в буфер
-    fread(buffer, 1, *file_size, file);
-    fclose(file);
+    return 0;
+}
+
 
-    return buffer;
+
+// Функция открытия выходного файла
+FILE* open_output(const char* path) {
+/**
+ * @brief Открывает выходной файл для записи в двоичном режиме
+ * 
+ * @param path Путь к файлу ("-" - стандартный вывод)
+ * @return FILE* Открытый файл или NULL при ошибке
+ */
+    if (strcmp(path, "-") == 0) {
+#ifdef _WIN32
+        _setmode(_fileno(stdout), _O_BINARY);
+#endif
+        return stdout;
+    }
+    return fopen(path, "wb");
+}
+
+
+
+// Функция закрытия выходного файла
+int close_output(FILE* output) {
+/**
+ * @return int 0 при успехе, иначе ошибка записи (стандартный вывод только сбрасывается)
+ */
+    return output == stdout ? fflush(stdout) : fclose(output);
 }
 
 
 
+// Размер фрагмента входа при потоковом кодировании
+#define STREAM_CHUNK_SIZE (1 << 20)
+
+// Входных байт на поток в одном окне параллельного кодирования (кратно 60 = НОК групп 1, 3, 4, 5)
+#define PARALLEL_WINDOW_PER_THREAD ((size_t)(4 << 20) / 60 * 60)
+
+// Размер закодированного файла, начиная с которого Base16/32/64/85 декодируются параллельно
+#define PARALLEL_DECODE_THRESHOLD ((size_t)8 << 20)
+
+// То же для Base58/Base62: перевод большого числа долог уже на сотнях килобайт
+#define PARALLEL_RADIX_THRESHOLD ((size_t)256 << 10)
+
+
+
 // Функция выбора алгоритма кодирования
-unsigned char* choice_of_alg(char* file_data, size_t file_size, char** dot_output) {
+int select_encoding_algorithm(void) {
 /**
- * @brief Выбирает алгоритм кодирования и кодирует данные
- * 
- * @param file_data Данные для кодирования
- * @param file_size Размер данных
- * @param dot_output Указатель для записи расширения выходного файла
- * @return unsigned char* Закодированные данные (нужно освободить) или NULL при ошибке
+ * @brief Выводит меню алгоритмов кодирования и читает номер
  * 
- * @note Выводит меню выбора алгоритма пользователю
- * @warning Выделяет память, которую нужно освободить через free()
+ * @return int Номер алгоритма (1-9)
  */
-    uint8_t choice;
-    unsigned char* encoded_data = NULL;
+    int choice;
 
     printf("Select encoding algorithm:\n");
     printf("1. Base16 - Data, hashing, memory addresses\n");
@@ -144,64 +204,271 @@ unsigned char* choice_of_alg(char* file_data, size_t file_size, char** dot_outpu
     printf("4. Base62 - Links, URLs, unique identifier generation\n");
     printf("5. Base64 - Standard encoding (email, API, images)\n");
     printf("6. Base85 - PDF, PostScript, data compression\n");
+    printf("7. Base58 (blocked) - 32-byte blocks, linear time for large files\n");
+    printf("8. Base62 (blocked) - 32-byte blocks, linear time for large files\n");
+    printf("9. Ascii85 - Adobe PDF/PostScript, 'z' runs and <~ ~> framing\n");
 
     while (1) {
-        printf("Enter the algorithm number (1-6): ");
-        if (scanf("%d", &choice) == 1 && choice >= 1 && choice <= 6) {
-            break;
-        } else {
-            printf("Invalid input, please try again.\n");
-            while (getchar() != '\n');  // Очистка буфера
+        printf("Enter the algorithm number (1-9): ");
+        if (scanf("%d", &choice) == 1 && choice >= 1 && choice <= 9) {
+            return choice;
         }
+        printf("Invalid input, please try again.\n");
+        while (getchar() != '\n');  // Очистка буфера
+    }
+}
+
+
+
+// Функция кодирования данных выбранным алгоритмом
+unsigned char* choice_of_alg(const char* file_data, size_t file_size, int choice, size_t* encoded_len,
+                             thread_pool* pool) {
+/**
+ * @brief Кодирует данные, целиком находящиеся в памяти, алгоритмом из меню
+ * 
+ * @param file_data Данные для кодирования
+ * @param file_size Размер данных
+ * @param choice Номер алгоритма (1-9)
+ * @param encoded_len Указатель для записи длины закодированных данных
+ * @param pool Пул потоков для Base58/Base62 (NULL - в вызывающем потоке)
+ * @return unsigned char* Закодированные данные (нужно освободить) или NULL при ошибке
+ * 
+ * @note Буфер выделяется один раз по длине результата выбранного алгоритма
+ *       (baseN_encoded_len), кодирование идёт функциями baseN_encode_into
+ *       (Base58/Base62 - baseN_encode_parallel)
+ * @warning Выделяет память, которую нужно освободить через free()
+ */
+    const unsigned char* input = (const unsigned char*)file_data;
+
+    // Длина результата выбранного алгоритма (для Base58/Base62/Ascii85 - верхняя оценка)
+    size_t capacity;
+    switch (choice) {
+        case 1: capacity = base16_encoded_len(file_size); break;
+        case 2: capacity = base32_encoded_len(file_size); break;
+        case 3: capacity = base58_encoded_len(file_size); break;
+        case 4: capacity = base62_encoded_len(file_size); break;
+        case 5: capacity = base64_encoded_len(file_size); break;
+        case 6: capacity = base85_encoded_len(file_size); break;
+        case 7: capacity = base58_blocked_encoded_len(file_size); break;
+        case 8: capacity = base62_blocked_encoded_len(file_size); break;
+        case 9: capacity = ascii85_encoded_len(file_size, ASCII85_FRAME); break;
+        default:
+            printf("Please select the algorithm correctly\n");
+            return NULL;
     }
 
-    // Выделение памяти для закодированных данных
-    encoded_data = (unsigned char*)malloc(file_size * 2);  // Пример для Base16 (можно изменить в зависимости от алгоритма)
+    // Выделение памяти для закодированных данных (+1 для завершающего нуля)
+    char* encoded_data = (char*)malloc(capacity + 1);
     if (!encoded_data) {
         perror("Memory allocation error for encoded data");
         return NULL;
     }
 
     // Выбор алгоритма
+    size_t length;
     switch (choice) {
-        case 1:
-            encoded_data = base16_encode(file_data, file_size, encoded_data);
-            *dot_output = ".base16";
-            printf("Base16 worked\n");
-            break;
-        case 2:
-            encoded_data = base32_encode(file_data, file_size, encoded_data);
-            *dot_output = ".base32";
-            printf("Base32 worked\n");
-            break;
-        case 3:
-            encoded_data = base58_encode(file_data, file_size, encoded_data);
-            *dot_output = ".base58";
-            printf("Base58 worked\n");
-            break;
-        case 4:
-            encoded_data = base62_encode(file_data, file_size, encoded_data);
-            *dot_output = ".base62";
-            printf("Base62 worked\n");
-            break;
-        case 5:
-            encoded_data = base64_encode(file_data, file_size);
-            *dot_output = ".base64";
-            printf("Base64 worked\n");
-            break;
-        case 6:
-            encoded_data = base85_encode(file_data, file_size);
-            *dot_output = ".base85";
-            printf("Base85 worked\n");
+        case 1: length = base16_encode_into(input, file_size, encoded_data, capacity); break;
+        case 2: length = base32_encode_into(input, file_size, encoded_data, capacity); break;
+        case 3: length = base58_encode_parallel(input, file_size, encoded_data, capacity, pool); break;
+        case 4: length = base62_encode_parallel(input, file_size, encoded_data, capacity, pool); break;
+        case 5: length = base64_encode_into(input, file_size, encoded_data, capacity); break;
+        case 6: length = base85_encode_into(input, file_size, encoded_data, capacity); break;
+        case 7: length = base58_encode_blocked_into(input, file_size, encoded_data, capacity); break;
+        case 8: length = base62_encode_blocked_into(input, file_size, encoded_data, capacity); break;
+        default: length = ascii85_encode_into(input, file_size, ASCII85_FRAME, encoded_data, capacity); break;
+    }
+
+    if (length == BASE_ERROR) {
+        free(encoded_data);
+        return NULL;
+    }
+    encoded_data[length] = '\0';
+    *encoded_len = length;
+
+    return (unsigned char*)encoded_data;
+}
+
+
+
+// Функция потокового кодирования файла буферами фиксированного размера
+int encode_file_stream(const char* input_path, FILE* output, int choice) {
+/**
+ * @brief Кодирует файл фрагментами по STREAM_CHUNK_SIZE байт потоковым API
+ * 
+ * @param input_path Путь к входному файлу ("-" - стандартный ввод)
+ * @param output Открытый выходной файл
+ * @param choice Номер алгоритма: 1 (Base16), 2 (Base32), 5 (Base64) или 6 (Base85)
+ * @return int 0 при успехе, -1 при ошибке чтения, записи или выделения памяти
+ * 
+ * @note Память не зависит от размера файла: один входной и один выходной буфер
+ */
+    void (*init)(base_enc_state*);
+    size_t (*update)(base_enc_state*, const unsigned char*, size_t, char*, size_t);
+    size_t (*final)(base_enc_state*, char*, size_t);
+    size_t (*encoded_len)(size_t);
+    switch (choice) {
+        case 1: init = base16_enc_init; update = base16_enc_update; final = base16_enc_final; encoded_len = base16_encoded_len; break;
+        case 2: init = base32_enc_init; update = base32_enc_update; final = base32_enc_final; encoded_len = base32_encoded_len; break;
+        case 5: init = base64_enc_init; update = base64_enc_update; final = base64_enc_final; encoded_len = base64_encoded_len; break;
+        case 6: init = base85_enc_init; update = base85_enc_update; final = base85_enc_final; encoded_len = base85_encoded_len; break;
+        default:
+            return -1;
+    }
+
+    int standard_input = strcmp(input_path, "-") == 0;
+    FILE* input = standard_input ? stdin : fopen(input_path, "rb");
+    if (!input) {
+        perror("Error opening file");
+        return -1;
+    }
+#ifdef _WIN32
+    if (standard_input) {
+        _setmode(_fileno(stdin), _O_BINARY);
+    }
+#endif
+
+    size_t capacity = encoded_len(STREAM_CHUNK_SIZE) + BASE_STREAM_SLACK;
+    unsigned char* chunk = (unsigned char*)malloc(STREAM_CHUNK_SIZE);
+    char* encoded = (char*)malloc(capacity);
+    int status = (chunk && encoded) ? 0 : -1;
+
+    base_enc_state state;
+    init(&state);
+
+    while (status == 0) {
+        size_t read = fread(chunk, 1, STREAM_CHUNK_SIZE, input);
+        size_t length = read ? update(&state, chunk, read, encoded, capacity) : final(&state, encoded, capacity);
+        if (length == BASE_ERROR || fwrite(encoded, 1, length, output) != length) {
+            status = -1;
+        }
+        if (read == 0) {
             break;
+        }
+    }
+    if (ferror(input)) {
+        status = -1;
+    }
+
+    free(chunk);
+    free(encoded);
+    if (!standard_input) {
+        fclose(input);
+    }
+    return status;
+}
+
 
+
+// Функция параллельного кодирования файла окнами фиксированного размера
+int encode_file_parallel(const char* input_path, FILE* output, int choice, thread_pool* pool) {
+/**
+ * @brief Кодирует файл на пуле потоков окнами по PARALLEL_WINDOW_PER_THREAD байт на поток
+ * 
+ * @param input_path Путь к входному файлу
+ * @param output Открытый выходной файл
+ * @param choice Номер алгоритма: 1 (Base16), 2 (Base32), 5 (Base64) или 6 (Base85)
+ * @param pool Пул потоков
+ * @return int 0 при успехе, -1 при ошибке чтения, записи или выделения памяти
+ * 
+ * @note Файл отображается в память; каждое окно кодируется всеми потоками в один
+ *       выходной буфер (baseN_encode_parallel) и записывается целиком. Окна кратны всем
+ *       размерам групп, поэтому результат совпадает с кодированием файла за один раз
+ */
+    size_t (*encode)(const unsigned char*, size_t, char*, size_t, thread_pool*);
+    size_t (*encoded_len)(size_t);
+    switch (choice) {
+        case 1: encode = base16_encode_parallel; encoded_len = base16_encoded_len; break;
+        case 2: encode = base32_encode_parallel; encoded_len = base32_encoded_len; break;
+        case 5: encode = base64_encode_parallel; encoded_len = base64_encoded_len; break;
+        case 6: encode = base85_encode_parallel; encoded_len = base85_encoded_len; break;
         default:
-            printf("Please select the algorithm correctly\n");
-            free(encoded_data);
-            return NULL;
+            return -1;
     }
 
-    return encoded_data;
+    file_view input;
+    if (file_view_open(input_path, &input) != 0) {
+        return -1;
+    }
+
+    size_t window = PARALLEL_WINDOW_PER_THREAD * (size_t)thread_pool_size(pool);
+    if (window > input.size) {
+        window = input.size;
+    }
+    size_t capacity = encoded_len(window);
+    char* encoded = (char*)malloc(capacity + 1);
+    int status = encoded ? 0 : -1;
+
+    for (size_t pos = 0; status == 0 && pos < input.size; pos += window) {
+        size_t n = input.size - pos < window ? input.size - pos : window;
+        size_t length = encode(input.data + pos, n, encoded, capacity, pool);
+        if (length == BASE_ERROR || fwrite(encoded, 1, length, output) != length) {
+            status = -1;
+        }
+    }
+
+    free(encoded);
+    file_view_close(&input);
+    return status;
+}
+
+
+
+// Функция кодирования файла в выходной файл
+int encode_file(const char* input_path, const char* output_path, int choice, thread_pool* pool) {
+/**
+ * @brief Кодирует файл выбранным алгоритмом и записывает результат в output_path
+ * 
+ * @param input_path Путь к входному файлу ("-" - стандартный ввод)
+ * @param output_path Путь к выходному файлу ("-" - стандартный вывод)
+ * @param choice Номер алгоритма (1-9)
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return int 0 при успехе, -1 при ошибке (недописанный выходной файл удаляется)
+ * 
+ * @note Base16/32/64/85 на пуле из нескольких потоков кодируются окнами (encode_file_parallel),
+ *       иначе потоково (encode_file_stream); остальные алгоритмы кодируют файл целиком
+ */
+    FILE* output = open_output(output_path);
+    if (!output) {
+        perror("Error writing to file");
+        return -1;
+    }
+    int standard_output = output == stdout;
+
+    int status;
+    if ((choice == 1 || choice == 2 || choice == 5 || choice == 6) && thread_pool_size(pool) > 1) {
+        // Блочные кодеки на нескольких потоках: окна файла делятся по границам групп
+        status = encode_file_parallel(input_path, output, choice, pool);
+    } else if (choice == 1 || choice == 2 || choice == 5 || choice == 6) {
+        // Блочные кодеки: поток фиксированными буферами, память не зависит от размера файла
+        status = encode_file_stream(input_path, output, choice);
+    } else {
+        // Base58/Base62/Ascii85: весь файл в памяти
+        file_view input;
+        const char* file_data = (const char*)read_file_as_bytes(input_path, &input);// Отображение файла в память
+        if (!file_data) {
+            close_output(output);
+            if (!standard_output) {
+                remove(output_path);
+            }
+            return -1;
+        }
+
+        size_t encoded_data_len = 0;
+        unsigned char* encoded_data = choice_of_alg(file_data, input.size, choice, &encoded_data_len, pool);
+        file_view_close(&input);
+        status = encoded_data ? 0 : -1;
+        if (encoded_data && fwrite(encoded_data, 1, encoded_data_len, output) != encoded_data_len) {
+            status = -1;
+        }
+        free(encoded_data); // Освобождаем память после использования
+    }
+    if (close_output(output) != 0) {
+        status = -1;
+    }
+    if (status != 0 && !standard_output) {
+        remove(output_path);
+    }
+    return status;
 }
 
 
@@ -279,53 +546,112 @@ char* decode_input_name(const char* name_input) {
 
 
 // Функция считывания данных из файла, который нужно декодировать 
-unsigned char* open_file_to_decod(char* filepath_decoded) {
+const unsigned char* open_file_to_decod(const char* filepath_decoded, file_view* view) {
 /**
- * @brief Читает файл для декодирования
+ * @brief Открывает файл для декодирования без копирования его содержимого
  * 
  * @param filepath_decoded Путь к файлу
- * @return unsigned char* Данные файла (нужно освободить) или NULL при ошибке
- * 
- * @warning Выделяет память, которую нужно освободить через free()
+ * @param view Структура для данных и размера файла (освободить через file_view_close)
+ * @return const unsigned char* Данные файла только для чтения или NULL при ошибке
  */
-    FILE *decod_file = fopen(filepath_decoded, "r");
-    if (!decod_file){
-        perror("Error opening file to decode.\n");
-        fclose(decod_file);
+    if (file_view_open(filepath_decoded, view) != 0) {
+        fprintf(stderr, "Error opening file to decode.\n");
         return NULL;
     }
+    return view->data;
+}
 
-    fseek(decod_file, 0, SEEK_END);
-    size_t file_size = ftell(decod_file);  // Получаем размер файла
-    rewind(decod_file);
-    
-    // Выделяем память для данных файла
-    unsigned char* buffer = (unsigned char*)malloc(file_size);
-    if (buffer == NULL) {
-        perror("Memory allocation error");
-        fclose(decod_file);
-        return NULL;
+
+
+// Функция параллельного декодирования данных
+int decode_parallel(const unsigned char* file_decode_data, const char* algorithm, size_t* file_size, int threads,
+                    unsigned char** decoded_data) {
+/**
+ * @brief Декодирует Base16/32/58/62/64/85 на пуле из threads потоков
+ * 
+ * @param file_decode_data Данные для декодирования
+ * @param algorithm Алгоритм декодирования
+ * @param file_size Указатель на размер данных (обновляется после декодирования)
+ * @param threads Число потоков (1 - без пула, в вызывающем потоке)
+ * @param decoded_data Декодированные данные (нужно освободить) или NULL при ошибке
+ * @return int 1, если данные обработаны (успешно или с ошибкой), 0, если алгоритм
+ *         не делится на части или пул не создан (нужно декодировать обычным путём)
+ * 
+ * @note При ошибке входа сообщает позицию первого недопустимого символа
+ */
+    size_t (*decode)(const unsigned char*, size_t, unsigned char*, size_t, thread_pool*, size_t*);
+    size_t (*decoded_max_len)(size_t);
+    if (strcmp(algorithm, "base16") == 0) {
+        decode = base16_decode_parallel; decoded_max_len = base16_decoded_max_len;
+    } else if (strcmp(algorithm, "base32") == 0) {
+        decode = base32_decode_parallel; decoded_max_len = base32_decoded_max_len;
+    } else if (strcmp(algorithm, "base64") == 0) {
+        decode = base64_decode_parallel; decoded_max_len = base64_decoded_max_len;
+    } else if (strcmp(algorithm, "base85") == 0) {
+        decode = base85_decode_parallel; decoded_max_len = base85_decoded_max_len;
+    } else if (strcmp(algorithm, "base58") == 0) {
+        decode = base58_decode_parallel; decoded_max_len = base58_decoded_max_len;
+    } else if (strcmp(algorithm, "base62") == 0) {
+        decode = base62_decode_parallel; decoded_max_len = base62_decoded_max_len;
+    } else {
+        return 0;
+    }
+
+    // Один поток - тот же путь без пула: части декодируются по очереди, а ошибка
+    // сообщается с позицией так же, как на нескольких потоках
+    thread_pool* pool = NULL;
+    if (threads > 1) {
+        pool = thread_pool_create(threads);
+        if (!pool) {
+            return 0;
+        }
+        fprintf(stderr, "Threads: %d\n", thread_pool_size(pool));
+    }
+
+    *decoded_data = NULL;
+    size_t capacity = decoded_max_len(*file_size);
+    unsigned char* output = (unsigned char*)malloc(capacity + 1);
+    if (!output) {
+        fprintf(stderr, "Error: Memory allocation failed.\n");
+        thread_pool_destroy(pool);
+        return 1;
     }
-    
-    // Чтение файла в буфер
-    fread(buffer, 1, file_size, decod_file);
-    fclose(decod_file);
 
-    return buffer;
+    size_t error_offset;
+    size_t length = decode(file_decode_data, *file_size, output, capacity, pool, &error_offset);
+    thread_pool_destroy(pool);
+    if (length == BASE_ERROR) {
+        if (error_offset != BASE_ERROR) {
+            fprintf(stderr, "%s decoding failed at offset %zu\n", algorithm, error_offset);
+        } else {
+            fprintf(stderr, "%s decoding failed\n", algorithm);
+        }
+        free(output);
+        return 1;
+    }
+
+    *file_size = length;
+    *decoded_data = output;
+    return 1;
 }
 
 
 
 // Функция определения алгоритма декодирования
-char* url_to_decod_algorithm(const unsigned char* file_decode_data, const char* algorithm, size_t* file_size) {
+char* url_to_decod_algorithm(const unsigned char* file_decode_data, const char* algorithm, size_t* file_size,
+                             int threads) {
 /**
  * @brief Декодирует данные с использованием указанного алгоритма
  * 
  * @param file_decode_data Данные для декодирования
  * @param algorithm Алгоритм декодирования
  * @param file_size Указатель на размер данных (обновляется после декодирования)
+ * @param threads Число потоков для больших входов
  * @return char* Декодированные данные (нужно освободить) или NULL при ошибке
  * 
+ * @note Входы от PARALLEL_DECODE_THRESHOLD байт (Base58/Base62 - от PARALLEL_RADIX_THRESHOLD)
+ *       всегда идут через decode_parallel (при threads 1 - в вызывающем потоке), поэтому
+ *       ошибка в большом входе сообщается с позицией на любой машине
  * @warning Выделяет память, которую нужно освободить через free()
  */
     if (!file_decode_data || !algorithm || *file_size == 0) {
@@ -333,11 +659,17 @@ char* url_to_decod_algorithm(const unsigned char* file_decode_data, const char*
         return NULL;
     }
 
+    unsigned char* parallel_data;
+    int radix = strcmp(algorithm, "base58") == 0 || strcmp(algorithm, "base62") == 0;
+    if (*file_size >= (radix ? PARALLEL_RADIX_THRESHOLD : PARALLEL_DECODE_THRESHOLD) &&
+        decode_parallel(file_decode_data, algorithm, file_size, threads, &parallel_data)) {
+        return (char*)parallel_data;
+    }
+
     // Выделяем память (максимально возможный размер, если потребуется)
     char* decoded_data = NULL;
     size_t decoded_length = 0;
     
-    size_t file_length;
     if (strcmp(algorithm, "base16") == 0) {
         // Проверка на четность длины входных данных
         if (*file_size % 2 != 0) {
@@ -353,7 +685,7 @@ char* url_to_decod_algorithm(const unsigned char* file_decode_data, const char*
         }
     
         // Декодирование
-        if (base16_decode(file_decode_data, *file_size, decoded_data) == NULL) {
+        if (base16_decode(file_decode_data, *file_size, (unsigned char*)decoded_data) == NULL) {
             free(decoded_data); // Освобождаем память в случае ошибки
             return NULL; // или другая обработка ошибки
         }
@@ -362,27 +694,39 @@ char* url_to_decod_algorithm(const unsigned char* file_decode_data, const char*
         *file_size = *file_size / 2;
     }
     else if (strcmp(algorithm, "base32") == 0) {
-        decoded_data = base32_decode(file_decode_data, *file_size, &decoded_length);
+        decoded_data = (char*)base32_decode(file_decode_data, *file_size, &decoded_length);
         *file_size = decoded_length; // Обновляем размер файла
     } 
     else if (strcmp(algorithm, "base58") == 0) {
-        decoded_data = base58_decode(file_decode_data, *file_size, &decoded_length);
+        decoded_data = (char*)base58_decode(file_decode_data, *file_size, &decoded_length);
         *file_size = decoded_length; // Обновляем размер файла
     } 
     else if (strcmp(algorithm, "base62") == 0) {
-        decoded_data = base62_decode(file_decode_data, *file_size, &decoded_length);
+        decoded_data = (char*)base62_decode(file_decode_data, *file_size, &decoded_length);
+        *file_size = decoded_length; // Обновляем размер файла
+    }
+    else if (strcmp(algorithm, "base58b") == 0) {
+        decoded_data = (char*)base58_decode_blocked(file_decode_data, *file_size, &decoded_length);
+        *file_size = decoded_length; // Обновляем размер файла
+    }
+    else if (strcmp(algorithm, "base62b") == 0) {
+        decoded_data = (char*)base62_decode_blocked(file_decode_data, *file_size, &decoded_length);
         *file_size = decoded_length; // Обновляем размер файла
     }
     else if (strcmp(algorithm, "base64") == 0) {
-        decoded_data = base64_decode(file_decode_data, *file_size, &decoded_length);
+        decoded_data = (char*)base64_decode(file_decode_data, *file_size, &decoded_length);
         *file_size = decoded_length; // Обновляем размер файла
 
     } 
     else if (strcmp(algorithm, "base85") == 0) {
-        decoded_data = base85_decode(file_decode_data, *file_size, &decoded_length);
+        decoded_data = (char*)base85_decode(file_decode_data, *file_size, &decoded_length);
         *file_size = decoded_length; // Обновляем размер файла
 
     } 
+    else if (strcmp(algorithm, "ascii85") == 0) {
+        decoded_data = (char*)ascii85_decode(file_decode_data, *file_size, &decoded_length);
+        *file_size = decoded_length; // Обновляем размер файла
+    }
     else {
         fprintf(stderr, "Unknown algorithm: %s\n", algorithm);
         free(decoded_data);
@@ -400,7 +744,7 @@ char* url_to_decod_algorithm(const unsigned char* file_decode_data, const char*
 
 
 // Функция удаления расширения
-char* clear_decoded_name(unsigned char* filename) {
+char* clear_decoded_name(char* filename) {
 /**
  * @brief Удаляет расширение из имени файла
  * 
@@ -419,62 +763,538 @@ char* clear_decoded_name(unsigned char* filename) {
 
 
 // Функция считывания данных из файла, который нужно декодировать
-char* read_decode(const char *filename, size_t *file_size){
+const unsigned char* read_decode(const char *filename, file_view* view){
 /**
- * @brief Читает файл для декодирования
+ * @brief Открывает файл для декодирования без копирования его содержимого
  * 
  * @param filename Имя файла
- * @param file_size Указатель для записи размера файла
- * @return char* Данные файла (нужно освободить) или NULL при ошибке
+ * @param view Структура для данных и размера файла (освободить через file_view_close)
+ * @return const unsigned char* Данные файла только для чтения или NULL при ошибке
  * 
- * @warning Выделяет память, которую нужно освободить через free()
+ * @note Обычный файл отображается в память, каналы и устройства читаются через read()
  */
-    FILE* file = fopen(filename, "r");
-    if (!file) {
-        perror("Error opening file");
+    if (file_view_open(filename, view) != 0) {
         return NULL;
     }
-    
-    fseek(file, 0, SEEK_END);
-    *file_size = ftell(file);  // Получаем размер файла
-    rewind(file);
-    
-    // Выделяем память для данных файла
-    unsigned char* buffer = (unsigned char*)malloc(*file_size);
-    if (buffer == NULL) {
+    return view->data;
+}
+
+
+
+// Функция декодирования файла в выходной файл
+int decode_file(const char* input_path, const char* output_path, const char* algorithm, int threads) {
+/**
+ * @brief Декодирует файл алгоритмом algorithm и записывает результат в output_path
+ * 
+ * @param input_path Путь к закодированному файлу ("-" - стандартный ввод)
+ * @param output_path Путь к выходному файлу ("-" - стандартный вывод)
+ * @param algorithm Алгоритм декодирования (расширение файла без точки)
+ * @param threads Число потоков для больших входов (1 - в вызывающем потоке)
+ * @return int 0 при успехе, -1 при ошибке (выходной файл не создаётся)
+ * 
+ * @note Пустой файл декодируется в пустой (так кодируются пустые входы)
+ */
+    file_view input;
+    const unsigned char* file_decode_data = read_decode(input_path, &input); // Получаем внутренность закодированного файла
+    if (!file_decode_data) {
+        perror("Error reading data");
+        return -1;
+    }
+
+    // Декодеры при ошибке записывают в длину 0, поэтому размер входа хранится отдельно
+    size_t input_size = input.size;
+    size_t decoded_len = input_size;
+    unsigned char* decoded_data = NULL;
+    if (input_size > 0) {
+        decoded_data = (unsigned char*)url_to_decod_algorithm(file_decode_data, algorithm, &decoded_len, threads);
+    }
+    file_view_close(&input);
+    if (input_size > 0 && !decoded_data) {
+        return -1;
+    }
+
+    int status = 0;
+    FILE* output = open_output(output_path);
+    if (!output) {
+        perror("Error writing to file");
+        status = -1;
+    } else {
+        int standard_output = output == stdout;
+        if (decoded_data && fwrite(decoded_data, 1, decoded_len, output) != decoded_len) {
+            status = -1;
+        }
+        if (close_output(output) != 0) {
+            status = -1;
+        }
+        if (status != 0 && !standard_output) {
+            remove(output_path);
+        }
+    }
+    free(decoded_data); // Освобождаем память после использования
+    return status;
+}
+
+
+
+// Общие данные задач пакетного режима
+typedef struct {
+    const file_list* files;
+    int encode;           // 1 - кодирование, 0 - декодирование
+    int choice;           // номер алгоритма (при декодировании 0 - по расширению каждого файла)
+    char** output_paths;  // выходной путь каждого файла (NULL - файл отбракован до запуска)
+    char** algorithms;    // алгоритм декодирования каждого файла
+    int* status;          // результат по каждому файлу: 0 - успех, -1 - ошибка
+} batch_ctx;
+
+
+
+// Функция выбора выходного пути файла пакета
+int batch_prepare(batch_ctx* batch, size_t index, const char* output_dir) {
+/**
+ * @brief Определяет алгоритм декодирования и выходной путь index-го файла пакета
+ * 
+ * @param output_dir Каталог для результатов (с завершающим '/')
+ * @return int 0 при успехе, -1 если имя не определено (сообщение выводится в stderr)
+ */
+    const char* input_path = batch->files->entries[index].path;
+    const char* name = get_filename(input_path);
+    char* output_name = NULL;
+    char* algorithm = NULL;
+
+    if (batch->encode) {
+        output_name = create_output_name(name, encoding_extensions[batch->choice]);
+    } else {
+        // Алгоритм - из расширения, как при декодировании одного файла (run_command):
+        // README.base64, полученный из README, тоже декодируется
+        algorithm = batch->choice ? strdup(encoding_extensions[batch->choice] + 1) : extension_definition(name);
+        if (algorithm && encoding_by_name(algorithm) == 0) {
+            fprintf(stderr, "%s: unknown algorithm %s\n", input_path, algorithm);
+            free(algorithm);
+            return -1;
+        }
+        if (algorithm && (output_name = strdup(name)) != NULL) {
+            clear_decoded_name(output_name);
+        }
+    }
+    if (output_name) {
+        batch->output_paths[index] = create_output_name(output_dir, output_name);
+        free(output_name);
+    }
+
+    if (!batch->output_paths[index]) {
+        fprintf(stderr, "%s: unable to determine output name\n", input_path);
+        free(algorithm);
+        return -1;
+    }
+    batch->algorithms[index] = algorithm;
+    return 0;
+}
+
+
+
+// Выходной путь файла пакета с его номером (для поиска совпадений)
+typedef struct {
+    const char* path;
+    size_t index;
+} batch_output;
+
+
+
+// Функция сравнения выходных путей пакета (для qsort)
+int compare_batch_outputs(const void* a, const void* b) {
+    const batch_output* output_a = (const batch_output*)a;
+    const batch_output* output_b = (const batch_output*)b;
+    int order = strcmp(output_a->path, output_b->path);
+    if (order != 0) {
+        return order;
+    }
+    return (output_a->index > output_b->index) - (output_a->index < output_b->index);
+}
+
+
+
+// Функция отбраковки файлов пакета с совпадающими выходными путями
+int batch_reject_collisions(batch_ctx* batch) {
+/**
+ * @brief Находит файлы пакета, которые записали бы результат в один и тот же файл
+ *        (одинаковые имена в разных каталогах списка), и отбраковывает их все
+ * 
+ * @return int 0 при успехе, -1 при ошибке выделения памяти
+ * 
+ * @note Отбракованные файлы получают статус ошибки и не обрабатываются: иначе результат
+ *       одного молча заменился бы другим, а при нескольких потоках они писали бы в файл вместе
+ */
+    size_t count = batch->files->count;
+    batch_output* outputs = (batch_output*)malloc((count ? count : 1) * sizeof(batch_output));
+    if (!outputs) {
+        return -1;
+    }
+
+    size_t used = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (batch->output_paths[i]) {
+            outputs[used].path = batch->output_paths[i];
+            outputs[used].index = i;
+            used++;
+        }
+    }
+    qsort(outputs, used, sizeof(batch_output), compare_batch_outputs);
+
+    for (size_t start = 0, end; start < used; start = end) {
+        for (end = start + 1; end < used && strcmp(outputs[end].path, outputs[start].path) == 0; end++);
+        if (end - start < 2) {
+            continue;
+        }
+        for (size_t k = start; k < end; k++) {
+            size_t other = outputs[k == start ? start + 1 : start].index;
+            fprintf(stderr, "%s: output %s collides with %s\n", batch->files->entries[outputs[k].index].path,
+                    outputs[k].path, batch->files->entries[other].path);
+        }
+        // Пути освобождаются после вывода сообщений: outputs ссылается на них
+        for (size_t k = start; k < end; k++) {
+            size_t index = outputs[k].index;
+            free(batch->output_paths[index]);
+            batch->output_paths[index] = NULL;
+            batch->status[index] = -1;
+        }
+    }
+
+    free(outputs);
+    return 0;
+}
+
+
+
+// Функция обработки одного файла пакета
+void batch_task(void* ctx, size_t index) {
+/**
+ * @brief Кодирует или декодирует index-й файл пакета по пути, выбранному batch_prepare
+ * 
+ * @note Файл обрабатывается целиком в одном потоке: параллельность пакета - между файлами
+ */
+    batch_ctx* batch = (batch_ctx*)ctx;
+    const char* input_path = batch->files->entries[index].path;
+    const char* output_path = batch->output_paths[index];
+    if (!output_path) {
+        return;  // отбракован до запуска, статус и сообщение уже есть
+    }
+
+    int status;
+    if (batch->encode) {
+        status = encode_file(input_path, output_path, batch->choice, NULL);
+    } else {
+        status = decode_file(input_path, output_path, batch->algorithms[index], 1);
+    }
+    if (status != 0) {
+        fprintf(stderr, "%s: %s failed\n", input_path, batch->encode ? "encoding" : "decoding");
+    }
+    batch->status[index] = status;
+}
+
+
+
+// Функция сравнения файлов пакета по убыванию размера (для qsort)
+int compare_larger_first(const void* a, const void* b) {
+    size_t size_a = ((const file_entry*)a)->size;
+    size_t size_b = ((const file_entry*)b)->size;
+    return (size_a < size_b) - (size_a > size_b);
+}
+
+
+
+// Функция пакетной обработки каталога или списка файлов
+int run_batch(const char* source, int encode, int choice, int threads, const char* output_dir) {
+/**
+ * @brief Кодирует или декодирует все файлы каталога или файла-списка
+ * 
+ * @param source Каталог или текстовый файл со списком путей
+ * @param encode 1 - кодирование, 0 - декодирование
+ * @param choice Номер алгоритма (1-9); при декодировании 0 - по расширению каждого файла
+ * @param threads Число потоков (0 - по числу процессоров)
+ * @param output_dir Каталог для результатов (с завершающим '/'; создаётся, если его нет)
+ * @return int 0, если все файлы обработаны успешно, иначе 1
+ * 
+ * @note Файлы сортируются по убыванию размера и разбираются потоками пула из общей
+ *       очереди: крупные файлы начинаются первыми и не остаются в хвосте пакета,
+ *       а освободившийся поток сразу берёт следующий файл
+ * @note Файлы с совпадающими выходными путями не обрабатываются и считаются ошибками
+ */
+    // Каталог результатов проверяется один раз, а не ошибкой записи на каждом файле
+    if (file_make_directory(output_dir) != 0) {
+        perror(output_dir);
+        return 1;
+    }
+
+    file_list files;
+    if (file_list_open(source, &files) != 0) {
+        return 1;
+    }
+    qsort(files.entries, files.count, sizeof(file_entry), compare_larger_first);
+
+    size_t slots = files.count ? files.count : 1;
+    int* status = (int*)calloc(slots, sizeof(int));
+    char** output_paths = (char**)calloc(slots, sizeof(char*));
+    char** algorithms = (char**)calloc(slots, sizeof(char*));
+    batch_ctx batch = {&files, encode, choice, output_paths, algorithms, status};
+    if (!status || !output_paths || !algorithms) {
         perror("Memory allocation error");
-        fclose(file);
-        return NULL;
+        free(status);
+        free(output_paths);
+        free(algorithms);
+        file_list_close(&files);
+        return 1;
     }
-    
-    // Чтение файла в буфер
-    fread(buffer, 1, *file_size, file);
-    fclose(file);
-    return buffer;
+
+    // Выходные пути выбираются до запуска, чтобы найти файлы, пишущие в одно место
+    for (size_t i = 0; i < files.count; i++) {
+        if (batch_prepare(&batch, i, output_dir) != 0) {
+            status[i] = -1;
+        }
+    }
+    if (batch_reject_collisions(&batch) != 0) {
+        perror("Memory allocation error");
+        for (size_t i = 0; i < files.count; i++) {
+            status[i] = -1;
+            free(output_paths[i]);
+            output_paths[i] = NULL;
+        }
+    }
+
+    // Ядра выбираются до запуска потоков, а не наперегонки в них
+    encode_kernels_init();
+    decode_kernels_init();
+
+    thread_pool* pool = thread_pool_create(threads > 0 ? threads : parallel_cpu_count());
+    printf("Batch: %zu files, threads: %d\n", files.count, thread_pool_size(pool));
+
+    thread_pool_run(pool, files.count, batch_task, &batch);
+    thread_pool_destroy(pool);
+
+    size_t failed = 0;
+    for (size_t i = 0; i < files.count; i++) {
+        if (status[i] != 0) {
+            failed++;
+        }
+    }
+    // Пути, отброшенные ещё при сборке списка, тоже считаются ошибками пакета
+    printf("Processed: %zu, failed: %zu\n", files.count - failed, failed + files.skipped);
+    failed += files.skipped;
+
+    for (size_t i = 0; i < files.count; i++) {
+        free(output_paths[i]);
+        free(algorithms[i]);
+    }
+    free(output_paths);
+    free(algorithms);
+    free(status);
+    file_list_close(&files);
+    return failed ? 1 : 0;
 }
 
 
 
-int main(void) {
+// Функция вывода справки по командной строке
+void print_usage(FILE* stream, const char* program) {
+    fprintf(stream,
+            "Usage: %s [--cpu=TIER] [-j N] encode -a ALGORITHM [-i INPUT] [-o OUTPUT]\n"
+            "       %s [--cpu=TIER] [-j N] decode [-a ALGORITHM] [-i INPUT] [-o OUTPUT]\n"
+            "       %s [--cpu=TIER] [-j N]   (interactive menu)\n"
+            "\n"
+            "  -a ALGORITHM  base16, base32, base58, base62, base64, base85, base58b, base62b, ascii85\n"
+            "                (decode: taken from the input file extension if omitted)\n"
+            "  -i INPUT      input file, '-' for stdin (default), or a directory for batch mode\n"
+            "  -o OUTPUT     output file, '-' for stdout; default: " OUTPUT_DIR "NAME, or stdout for stdin\n"
+            "                (batch mode: output directory, default " OUTPUT_DIR ")\n"
+            "  --batch PATH  batch mode over a directory or a file with one path per line\n"
+            "  -j N          threads (0 - one per CPU)\n"
+            "  --cpu=TIER    limit SIMD kernels: scalar, sse2, ssse3, avx2, avx512, neon\n",
+            program, program, program);
+}
+
+
+
+// Функция выполнения команды encode/decode из командной строки
+int run_command(int encode, const char* algorithm_name, const char* input_path, const char* output_path,
+                const char* batch_source, int threads) {
+/**
+ * @brief Кодирует или декодирует файл, стандартный ввод или пакет файлов без диалога
+ * 
+ * @param encode 1 - encode, 0 - decode
+ * @param algorithm_name Название алгоритма (-a) или NULL
+ * @param input_path Входной файл, "-" или каталог (-i); NULL - стандартный ввод
+ * @param output_path Выходной файл, "-" или каталог пакета (-o); NULL - по умолчанию
+ * @param batch_source Каталог или файл-список пакетного режима (--batch) или NULL
+ * @param threads Число потоков (0 - не задано)
+ * @return int Код завершения программы: 0 - успех, 1 - ошибка
+ * 
+ * @note Сообщения выводятся в stderr: стандартный вывод может быть занят результатом
+ */
+    int choice = 0;
+    if (algorithm_name && (choice = encoding_by_name(algorithm_name)) == 0) {
+        fprintf(stderr, "Unknown algorithm: %s\n", algorithm_name);
+        return 1;
+    }
+    if (encode && choice == 0) {
+        fprintf(stderr, "Encoding algorithm is required (-a)\n");
+        return 1;
+    }
+
+    if (!input_path) {
+        input_path = batch_source ? batch_source : "-";
+    }
+    if (!batch_source && strcmp(input_path, "-") != 0 && file_is_directory(input_path)) {
+        batch_source = input_path;
+    }
+
+    if (batch_source) {
+        // Каталог результатов пакета с завершающим '/'
+        const char* dir = output_path ? output_path : OUTPUT_DIR;
+        size_t length = strlen(dir);
+        char* output_dir = create_output_name(dir, length > 0 && dir[length - 1] != '/' ? "/" : "");
+        if (!output_dir) {
+            perror("Memory allocation error");
+            return 1;
+        }
+        int result = run_batch(batch_source, encode, choice, threads, output_dir);
+        free(output_dir);
+        return result;
+    }
+
+    int standard_input = strcmp(input_path, "-") == 0;
+    const char* name = get_filename(input_path);
+    char* algorithm = NULL;
+    char* output_name = NULL;
+    char* default_output = NULL;
+
+    if (encode) {
+        if (!output_path && !standard_input) {
+            output_name = create_output_name(name, encoding_extensions[choice]);
+        }
+    } else {
+        // Алгоритм декодирования - из -a или из расширения файла
+        algorithm = choice ? strdup(encoding_extensions[choice] + 1) : (standard_input ? NULL : extension_definition(name));
+        if (!algorithm || encoding_by_name(algorithm) == 0) {
+            fprintf(stderr, "Unable to determine algorithm, use -a\n");
+            free(algorithm);
+            return 1;
+        }
+        if (!output_path && !standard_input && (output_name = strdup(name)) != NULL) {
+            clear_decoded_name(output_name);
+        }
+    }
+
+    if (!output_path) {
+        if (standard_input) {
+            output_path = "-";
+        } else if (!output_name || (default_output = create_output_name(OUTPUT_DIR, output_name)) == NULL) {
+            perror("Error creating output file name");
+            free(algorithm);
+            free(output_name);
+            return 1;
+        } else {
+            output_path = default_output;
+        }
+    }
+
+    int status;
+    if (encode) {
+        thread_pool* pool = NULL;
+        if (choice != 7 && choice != 8 && choice != 9 && threads > 1) {
+            // Base16/32/64/85 - окна файла на нескольких потоках, Base58/Base62 - перевод большого числа
+            pool = thread_pool_create(threads);
+        }
+        status = encode_file(input_path, output_path, choice, pool);
+        thread_pool_destroy(pool);
+    } else {
+        status = decode_file(input_path, output_path, algorithm, threads > 0 ? threads : parallel_cpu_count());
+    }
+    if (status != 0) {
+        fprintf(stderr, "%s: %s failed\n", input_path, encode ? "encoding" : "decoding");
+    }
+
+    free(algorithm);
+    free(output_name);
+    free(default_output);
+    return status == 0 ? 0 : 1;
+}
+
+
+
+int main(int argc, char* argv[]) {
 /**
  * @brief Главная функция программы
  * 
+ * @param argc Количество аргументов командной строки
+ * @param argv Аргументы: команда encode/decode с -a, -i, -o, --batch (см. print_usage),
+ *             необязательные --cpu=TIER (scalar, sse2, ssse3, avx2, avx512, neon)
+ *             и -j N (число потоков, 0 - по числу процессоров)
  * @return int Код завершения программы
  * 
- * @note Предоставляет интерфейс для выбора между кодированием и декодированием
+ * @note Без команды предоставляет диалог для выбора между кодированием и декодированием
+ * @note --cpu ограничивает используемые векторные ядра (как переменная окружения BASE_CPU)
+ * @note С -j N больше 1 Base16/32/58/62/64/85 кодируются параллельно на N потоках; большие
+ *       файлы этих форматов декодируются параллельно и без -j (по числу процессоров)
+ * @note Каталог в -i или --batch обрабатывается пакетом: все файлы кодируются (декодируются)
+ *       на пуле потоков (по числу процессоров, если -j не задан), по одному файлу на поток
  */
+    int threads = 0;  // не задано: кодирование в одном потоке, декодирование по числу процессоров
+    int command = -1;  // 1 - encode, 0 - decode, -1 - диалог
+    const char* algorithm_name = NULL;
+    const char* input_path = NULL;
+    const char* output_path = NULL;
+    const char* batch_source = NULL;
+    for (int arg = 1; arg < argc; arg++) {
+        const char* value = arg + 1 < argc ? argv[arg + 1] : NULL;
+        if (strncmp(argv[arg], "--cpu=", 6) == 0) {
+            if (cpu_features_limit(argv[arg] + 6) != 0) {
+                fprintf(stderr, "Unknown CPU tier: %s\n", argv[arg] + 6);
+                return 1;
+            }
+        } else if (strncmp(argv[arg], "-j", 2) == 0) {
+            const char* count_text = argv[arg][2] ? argv[arg] + 2 : (arg + 1 < argc ? argv[++arg] : "");
+            char* end;
+            long count = strtol(count_text, &end, 10);
+            if (*count_text == '\0' || *end != '\0' || count < 0) {
+                fprintf(stderr, "Invalid thread count: %s\n", count_text);
+                return 1;
+            }
+            threads = count == 0 ? parallel_cpu_count() : (int)(count < PARALLEL_MAX_THREADS ? count : PARALLEL_MAX_THREADS);
+        } else if (strcmp(argv[arg], "-h") == 0 || strcmp(argv[arg], "--help") == 0) {
+            print_usage(stdout, argv[0]);
+            return 0;
+        } else if (command < 0 && (strcmp(argv[arg], "encode") == 0 || strcmp(argv[arg], "decode") == 0)) {
+            command = strcmp(argv[arg], "encode") == 0;
+        } else if (command >= 0 && value && strcmp(argv[arg], "-a") == 0) {
+            algorithm_name = argv[++arg];
+        } else if (command >= 0 && value && strcmp(argv[arg], "-i") == 0) {
+            input_path = argv[++arg];
+        } else if (command >= 0 && value && strcmp(argv[arg], "-o") == 0) {
+            output_path = argv[++arg];
+        } else if (command >= 0 && value && strcmp(argv[arg], "--batch") == 0) {
+            batch_source = argv[++arg];
+        } else {
+            fprintf(stderr, "Invalid argument: %s\n", argv[arg]);
+            print_usage(stderr, argv[0]);
+            return 1;
+        }
+    }
+
+    if (command >= 0) {
+        return run_command(command, algorithm_name, input_path, output_path, batch_source, threads);
+    }
+
+    printf("CPU tier: %s\n", cpu_tier_name());
+
     printf("Encode / Decode: ");
     char ans[10];
-    char output_dir[] = "output/";
-    scanf("%s", &ans);
+    char output_dir[] = OUTPUT_DIR;
+    scanf("%9s", ans);
     if (strcmp(ans, "Encode") == 0)
     {
         char filepath[256]; // Выделяем память для хранения пути к файлу
-        uint8_t choice; //Выбор алгоритма кодирования
-        size_t file_size;
         // Ввод пути к файлу
         printf("Enter the file path: ");
-        scanf("%s", filepath);
+        scanf("%255s", filepath);
 
         // Извлекаем имя файла (для информации)
         const char* file_encode_name = get_filename(filepath);
@@ -488,52 +1308,38 @@ int main(void) {
             return 1;
         }
         
-        char* dot_output = NULL;
         printf("File name: %s\n", file_encode_name);
 
-        char* file_data = read_file_as_bytes(filepath, &file_size);// Преобразование файла в байтовую строку
-        if (!file_data) {
-            perror("File reading error.\n");
-            return 1;
-        }
+        int choice = select_encoding_algorithm(); // Выбираем алгоритм кодирования
 
-        unsigned char* encoded_data = choice_of_alg(file_data, file_size, &dot_output);// Выбираем алгоритм кодирования
-        if (!encoded_data) {
-            perror("File encoding error.\n");
-            free(file_data);
-            return 1;
-        }
-
-        char* output_n = create_output_name(file_encode_name, dot_output);// Получение имени 
+        char* output_n = create_output_name(file_encode_name, encoding_extensions[choice]);// Получение имени 
         if (!output_n) {
             perror("Error creating output file name.\n");
-            free(file_data);
-            free(encoded_data);
             return 1;
         }
         char output_name[256];
         snprintf(output_name, sizeof(output_name), "%s%s", output_dir, output_n);
+        free(output_n);
 
-        if (encoded_data) {
-            printf("The file has been successfully encoded!\n", encoded_data);
-            FILE *output = fopen(output_name, "w");
-            if (output){
-                size_t encoded_data_len = strlen(encoded_data);
-                fwrite(encoded_data, 1, encoded_data_len, output);
-                fclose(output);
-            }
-            else{
-                perror("Error writing to file.\n");
-            }
-            free(encoded_data); // Освобождаем память после использования    
+        thread_pool* pool = NULL;
+        if ((choice != 7 && choice != 8 && choice != 9) && threads > 1 && (pool = thread_pool_create(threads)) != NULL) {
+            // Base16/32/64/85 - окна файла на нескольких потоках, Base58/Base62 - перевод большого числа
+            printf("Threads: %d\n", thread_pool_size(pool));
+        }
+        int status = encode_file(filepath, output_name, choice, pool);
+        thread_pool_destroy(pool);
+
+        if (status == 0) {
+            printf("%s worked\n", encoding_names[choice]);
+            printf("The file has been successfully encoded!\n");
         } else {
-            printf("File encoding error.\n");
+            perror("File encoding error.\n");
+            return 1;
         }
     }
 
     else if (strcmp(ans, "Decode") == 0){
         char filepath_decode[256]; // Буфер для пути к файлу
-        size_t file_size;
         printf("Enter the path to the file: ");
         scanf("%255s", filepath_decode); // Читаем путь к файлу
 
@@ -548,37 +1354,22 @@ int main(void) {
             return 1; // Завершаем программу с ошибкой
         }
 
-        unsigned char* file_decode_data = read_decode(filepath_decode, &file_size); // Получаем внутренность закодированного файла
-        if (!file_decode_data){
-            perror("Error reading data");
+        char *final_name = strdup(file_decode_name);
+        if (!final_name) {
+            perror("Error allocating memory for final_name");
             return 1;
         }
+        final_name = clear_decoded_name(final_name);
+        char output_name[256];
+        snprintf(output_name, sizeof(output_name), "%s%s", output_dir, final_name);
+        free(final_name);
 
-        unsigned char* decoded_data = url_to_decod_algorithm(file_decode_data, algorithm, &file_size);
-        if (decoded_data) {
-            char output_name[256];
-            char *final_name = strdup(file_decode_name);
-            if (!final_name) {
-                perror("Error allocating memory for final_name");
-                return 1;
-            }
-            final_name = clear_decoded_name(final_name);
-
-            snprintf(output_name, sizeof(output_name), "%s%s", output_dir, final_name);
-            printf("The file has been successfully decoded!\n", decoded_data);
-            FILE *output = fopen(output_name, "wb");
-            if (output){
-                fwrite(decoded_data, 1, file_size, output);
-                fclose(output);
-            }
-            else{
-                perror("Error writing to file.\n");
-            }
-            free(decoded_data); // Освобождаем память после использования    
+        if (decode_file(filepath_decode, output_name, algorithm, threads > 0 ? threads : parallel_cpu_count()) == 0) {
+            printf("The file has been successfully decoded!\n");
         } else {
             printf("File decoding error.\n");
         }
-        
+        free(algorithm);
     }   
     else{
         printf("Incorrect algorithm name.\n");
@@ -0,0 +1,214 @@
+/**
+ * @file parallel.c
+ * @brief Пул потоков для параллельного кодирования и декодирования
+ * 
+ * @note Задачи пачки разбираются потоками по одной из общего счётчика, поэтому освободившийся
+ *       поток сразу берёт следующую. Вызывающий поток тоже выполняет задачи, так что пул
+ *       из N потоков создаёт N - 1 рабочих. На платформах без pthreads задачи выполняются
+ *       последовательно в вызывающем потоке.
+ */
+
+#define _DEFAULT_SOURCE  // sysconf(_SC_NPROCESSORS_ONLN) при сборке с -std=c99
+
+#include "../include/parallel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define PARALLEL_POSIX 1
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+
+
+#ifdef PARALLEL_POSIX
+struct thread_pool {
+    pthread_t workers[PARALLEL_MAX_THREADS];
+    int threads;                 // потоков вместе с вызывающим
+    pthread_mutex_t lock;
+    pthread_cond_t wake;         // новая пачка задач или остановка
+    pthread_cond_t idle;         // все задачи пачки выполнены
+    parallel_task task;
+    void* ctx;
+    size_t count;                // задач в текущей пачке
+    size_t next;                 // номер следующей невзятой задачи
+    size_t done;                 // выполнено задач
+    unsigned long generation;    // номер пачки: рабочий поток ждёт, пока он не сменится
+    int stop;
+};
+
+
+
+// Функция выполнения задач текущей пачки
+static void pool_drain(thread_pool* pool) {
+/**
+ * @brief Берёт задачи из общего счётчика, пока они не кончатся
+ * 
+ * @note Вызывается с захваченной блокировкой и возвращает её захваченной
+ */
+    while (pool->next < pool->count) {
+        size_t index = pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+        pool->task(pool->ctx, index);
+        pthread_mutex_lock(&pool->lock);
+        if (++pool->done == pool->count) {
+            pthread_cond_broadcast(&pool->idle);
+        }
+    }
+}
+
+
+
+// Функция рабочего потока
+static void* pool_worker(void* arg) {
+    thread_pool* pool = (thread_pool*)arg;
+    unsigned long seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    while (1) {
+        while (!pool->stop && pool->generation == seen) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        if (pool->stop) {
+            break;
+        }
+        seen = pool->generation;
+        pool_drain(pool);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+#else
+struct thread_pool {
+    int threads;
+};
+#endif
+
+
+
+// Функция количества доступных процессоров
+int parallel_cpu_count(void) {
+/**
+ * @brief Возвращает число процессоров в сети (не больше PARALLEL_MAX_THREADS)
+ */
+#ifdef PARALLEL_POSIX
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    if (count > PARALLEL_MAX_THREADS) {
+        return PARALLEL_MAX_THREADS;
+    }
+    if (count > 0) {
+        return (int)count;
+    }
+#endif
+    return 1;
+}
+
+
+
+// Функция создания пула потоков
+thread_pool* thread_pool_create(int threads) {
+/**
+ * @brief Создаёт пул и запускает threads - 1 рабочих потоков
+ * 
+ * @param threads Число потоков вместе с вызывающим (ограничивается PARALLEL_MAX_THREADS)
+ * @return thread_pool* Пул или NULL при ошибке
+ */
+    if (threads < 1) {
+        threads = 1;
+    }
+    if (threads > PARALLEL_MAX_THREADS) {
+        threads = PARALLEL_MAX_THREADS;
+    }
+
+    thread_pool* pool = (thread_pool*)calloc(1, sizeof(thread_pool));
+    if (!pool) {
+        return NULL;
+    }
+
+#ifdef PARALLEL_POSIX
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+    pool->threads = 1;
+    for (int t = 1; t < threads; t++) {
+        if (pthread_create(&pool->workers[t - 1], NULL, pool_worker, pool) != 0) {
+            break;  // работаем с теми потоками, которые удалось создать
+        }
+        pool->threads++;
+    }
+#else
+    pool->threads = 1;
+#endif
+    return pool;
+}
+
+
+
+// Функция числа потоков пула
+int thread_pool_size(const thread_pool* pool) {
+    return pool ? pool->threads : 1;
+}
+
+
+
+// Функция выполнения пачки задач на пуле
+void thread_pool_run(thread_pool* pool, size_t count, parallel_task task, void* ctx) {
+/**
+ * @brief Раздаёт count задач потокам пула и ждёт их завершения
+ * 
+ * @param pool Пул (NULL - выполнить задачи последовательно)
+ * @param count Количество задач
+ * @param task Функция задачи
+ * @param ctx Общий контекст задач
+ * 
+ * @note Вызывающий поток выполняет задачи наравне с рабочими
+ */
+#ifdef PARALLEL_POSIX
+    if (pool && pool->threads > 1 && count > 1) {
+        pthread_mutex_lock(&pool->lock);
+        pool->task = task;
+        pool->ctx = ctx;
+        pool->count = count;
+        pool->next = 0;
+        pool->done = 0;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->wake);
+
+        pool_drain(pool);
+        while (pool->done < pool->count) {
+            pthread_cond_wait(&pool->idle, &pool->lock);
+        }
+        pthread_mutex_unlock(&pool->lock);
+        return;
+    }
+#else
+    (void)pool;
+#endif
+    for (size_t index = 0; index < count; index++) {
+        task(ctx, index);
+    }
+}
+
+
+
+// Функция остановки потоков и освобождения пула
+void thread_pool_destroy(thread_pool* pool) {
+    if (!pool) {
+        return;
+    }
+#ifdef PARALLEL_POSIX
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (int t = 0; t < pool->threads - 1; t++) {
+        pthread_join(pool->workers[t], NULL);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->idle);
+#endif
+    free(pool);
+}
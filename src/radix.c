@@ -0,0 +1,713 @@
+/**
+ * @file radix.c
+ * @brief Арифметика больших чисел для кодеков с основанием, не являющимся степенью двойки (Base58, Base62)
+ * 
+ * @note При кодировании число хранится в 32-битных словах (little-endian по словам) по основанию
+ *       radix^5, поэтому на каждое умножение приходится 4 входных байта и 5 выходных цифр сразу.
+ *       При декодировании слова двоичные (основание 2^32), а цифры вносятся группами по 5.
+ *       Длинные входы переводятся рекурсивно: value = high * src^m + low, где степени src^m
+ *       получаются возведением в квадрат, а умножение выполняет bignum_mul (NTT), что даёт
+ *       O(n log^2 n) вместо O(n^2). С пулом потоков независимые поддеревья рекурсии
+ *       переводятся параллельно, а умножения верхних уровней делят NTT между потоками.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../include/radix.h"
+#include "../include/bignum.h"
+#include "../include/parallel.h"
+
+// Длина входа, начиная с которой перевод идёт методом "разделяй и властвуй" (подобраны замерами:
+// квадратичный перевод цифр в двоичные слова дешевле перевода байтов, поэтому его порог выше)
+#define RADIX_DC_BYTES_THRESHOLD 6144
+#define RADIX_DC_CHARS_THRESHOLD 16384
+
+// Длина листа рекурсии: листья переводятся квадратичным методом
+#define RADIX_DC_LEAF 1024
+
+// Наибольшая глубина рекурсии (длина входа до RADIX_DC_LEAF * 2^48)
+#define RADIX_DC_LEVELS 48
+
+// Поддеревьев рекурсии на поток при параллельном переводе (для выравнивания нагрузки)
+#define RADIX_DC_TASKS_PER_THREAD 4
+
+
+
+// Функция умножения числа на mul с прибавлением add (основание слова - константа)
+static inline size_t limbs_mul_add(uint32_t* limbs, size_t count, uint32_t mul, uint32_t add, uint64_t limb_base) {
+/**
+ * @brief limbs = limbs * mul + add за один проход
+ * 
+ * @return size_t Новое количество слов
+ * 
+ * @note При limb < limb_base <= 2^32 и mul <= 2^32 промежуточное значение помещается в 64 бита.
+ *       Функция встраивается с константным limb_base, и деление компилятор заменяет умножением.
+ */
+    uint64_t carry = add;
+    for (size_t k = 0; k < count; k++) {
+        uint64_t t = (uint64_t)limbs[k] * mul + carry;
+        limbs[k] = (uint32_t)(t % limb_base);
+        carry = t / limb_base;
+    }
+    while (carry > 0) {
+        limbs[count++] = (uint32_t)(carry % limb_base);
+        carry /= limb_base;
+    }
+    return count;
+}
+
+
+
+// Функция перевода байтов в слова для конкретного основания
+static inline size_t bytes_to_limbs(const unsigned char* input, size_t len, uint32_t* limbs, uint64_t limb_base) {
+/**
+ * @brief Вносит вход в число по 4 байта за одно умножение
+ */
+    size_t count = 0;
+    size_t i = 0;
+
+    // Первая неполная группа, чтобы дальше шли только полные по 4 байта
+    size_t head = len % 4;
+    if (head) {
+        uint32_t chunk = 0;
+        for (; i < head; i++) {
+            chunk = (chunk << 8) | input[i];
+        }
+        count = limbs_mul_add(limbs, count, 1, chunk, limb_base);
+    }
+
+    for (; i < len; i += 4) {
+        uint32_t chunk = ((uint32_t)input[i] << 24) | ((uint32_t)input[i + 1] << 16) |
+                         ((uint32_t)input[i + 2] << 8) | input[i + 3];
+        // Умножение на 2^32 = 256^4
+        uint64_t carry = chunk;
+        for (size_t k = 0; k < count; k++) {
+            uint64_t t = ((uint64_t)limbs[k] << 32) + carry;
+            limbs[k] = (uint32_t)(t % limb_base);
+            carry = t / limb_base;
+        }
+        while (carry > 0) {
+            limbs[count++] = (uint32_t)(carry % limb_base);
+            carry /= limb_base;
+        }
+    }
+    return count;
+}
+
+
+
+// Функция квадратичного перевода байтов в слова
+static size_t bytes_to_limbs_any(const unsigned char* input, size_t len, uint32_t* limbs, uint32_t limb_base) {
+/**
+ * @note Для известных оснований вызывается специализированная версия без аппаратного деления
+ */
+    switch (limb_base) {
+        case BASE58_LIMB:
+            return bytes_to_limbs(input, len, limbs, BASE58_LIMB);
+        case BASE62_LIMB:
+            return bytes_to_limbs(input, len, limbs, BASE62_LIMB);
+        default:
+            return bytes_to_limbs(input, len, limbs, limb_base);
+    }
+}
+
+
+
+// Функция выписывания слов в символы для конкретного основания
+static inline size_t limbs_to_chars(const uint32_t* limbs, size_t count, uint32_t radix, const char* table, char* output) {
+/**
+ * @brief Старшее слово выписывается без ведущих нулей, остальные - ровно по 5 цифр
+ */
+    size_t pos = 0;
+    if (count == 0) {
+        return 0;
+    }
+
+    // Старшее слово
+    char top[RADIX_LIMB_DIGITS];
+    size_t top_len = 0;
+    for (uint32_t value = limbs[count - 1]; value > 0; value /= radix) {
+        top[top_len++] = table[value % radix];
+    }
+    while (top_len > 0) {
+        output[pos++] = top[--top_len];
+    }
+
+    // Остальные слова
+    for (size_t k = count - 1; k-- > 0;) {
+        uint32_t value = limbs[k];
+        for (int d = RADIX_LIMB_DIGITS - 1; d >= 0; d--) {
+            output[pos + d] = table[value % radix];
+            value /= radix;
+        }
+        pos += RADIX_LIMB_DIGITS;
+    }
+    return pos;
+}
+
+
+
+// Функция выписывания слов по основанию radix^5 в символы алфавита
+size_t radix_limbs_to_chars(const uint32_t* limbs, size_t count, uint32_t radix, const char* table, char* output) {
+/**
+ * @brief Записывает число в виде символов алфавита, старшая цифра первой
+ * 
+ * @param limbs Слова числа (младшее первое), старшее слово ненулевое
+ * @param count Количество слов
+ * @param radix Основание системы счисления (58 или 62)
+ * @param table Алфавит
+ * @param output Буфер для символов (не меньше 5 * count)
+ * @return size_t Количество записанных символов (без завершающего нуля)
+ */
+    switch (radix) {
+        case 58:
+            return limbs_to_chars(limbs, count, 58, table, output);
+        case 62:
+            return limbs_to_chars(limbs, count, 62, table, output);
+        default:
+            return limbs_to_chars(limbs, count, radix, table, output);
+    }
+}
+
+
+
+// Функция количества символов, которое выпишет radix_limbs_to_chars
+size_t radix_limbs_chars_len(const uint32_t* limbs, size_t count, uint32_t radix) {
+/**
+ * @brief Считает длину записи числа без ведущих нулей, не выписывая цифры
+ * 
+ * @return size_t Цифры старшего слова плюс по 5 цифр на каждое остальное слово
+ */
+    if (count == 0) {
+        return 0;
+    }
+    size_t len = (count - 1) * RADIX_LIMB_DIGITS;
+    for (uint32_t value = limbs[count - 1]; value > 0; value /= radix) {
+        len++;
+    }
+    return len;
+}
+
+
+
+// Функция перевода символов в двоичные слова для конкретного основания
+static inline size_t chars_to_limbs(const unsigned char* input, size_t len, const unsigned char* rev_table, uint32_t radix, uint32_t* limbs) {
+/**
+ * @brief Вносит цифры в число группами по 5: одно умножение на radix^5 вместо пяти умножений на radix
+ */
+    const uint32_t group_mul = radix * radix * radix * radix * radix;
+    size_t count = 0;
+    size_t i = 0;
+
+    // Первая неполная группа, чтобы дальше шли только полные группы по 5 цифр
+    size_t head = len % RADIX_LIMB_DIGITS;
+    if (head) {
+        uint32_t chunk = 0;
+        for (; i < head; i++) {
+            chunk = chunk * radix + rev_table[input[i]];
+        }
+        count = limbs_mul_add(limbs, count, 1, chunk, (uint64_t)1 << 32);
+    }
+
+    for (; i < len; i += RADIX_LIMB_DIGITS) {
+        uint32_t chunk = rev_table[input[i]];
+        for (size_t d = 1; d < RADIX_LIMB_DIGITS; d++) {
+            chunk = chunk * radix + rev_table[input[i + d]];
+        }
+        count = limbs_mul_add(limbs, count, group_mul, chunk, (uint64_t)1 << 32);
+    }
+    return count;
+}
+
+
+
+// Функция квадратичного перевода символов в двоичные слова
+static size_t chars_to_limbs_any(const unsigned char* input, size_t len, const unsigned char* rev_table, uint32_t radix, uint32_t* limbs) {
+    switch (radix) {
+        case 58:
+            return chars_to_limbs(input, len, rev_table, 58, limbs);
+        case 62:
+            return chars_to_limbs(input, len, rev_table, 62, limbs);
+        default:
+            return chars_to_limbs(input, len, rev_table, radix, limbs);
+    }
+}
+
+
+
+// Функция выписывания 32-битных слов в байты (big-endian, без ведущих нулей)
+size_t radix_limbs_to_bytes(const uint32_t* limbs, size_t count, unsigned char* output) {
+/**
+ * @brief Записывает двоичное число старшим байтом вперёд
+ * 
+ * @param limbs Слова числа (младшее первое), старшее слово ненулевое
+ * @param count Количество слов
+ * @param output Буфер для байтов (не меньше 4 * count)
+ * @return size_t Количество записанных байтов
+ */
+    size_t pos = 0;
+    if (count == 0) {
+        return 0;
+    }
+
+    // Старшее слово без ведущих нулевых байтов
+    uint32_t top = limbs[count - 1];
+    int shift = 24;
+    while (shift > 0 && (top >> shift) == 0) {
+        shift -= 8;
+    }
+    for (; shift >= 0; shift -= 8) {
+        output[pos++] = (unsigned char)(top >> shift);
+    }
+
+    for (size_t k = count - 1; k-- > 0;) {
+        output[pos++] = (unsigned char)(limbs[k] >> 24);
+        output[pos++] = (unsigned char)(limbs[k] >> 16);
+        output[pos++] = (unsigned char)(limbs[k] >> 8);
+        output[pos++] = (unsigned char)limbs[k];
+    }
+    return pos;
+}
+
+
+
+// Функция количества байтов, которое выпишет radix_limbs_to_bytes
+size_t radix_limbs_bytes_len(const uint32_t* limbs, size_t count) {
+/**
+ * @brief Считает длину двоичной записи числа без ведущих нулевых байтов
+ */
+    if (count == 0) {
+        return 0;
+    }
+    size_t len = (count - 1) * 4 + 1;
+    for (uint32_t top = limbs[count - 1] >> 8; top > 0; top >>= 8) {
+        len++;
+    }
+    return len;
+}
+
+
+
+// Параметры рекурсивного перевода
+typedef struct {
+    const unsigned char* rev_table; // обратная таблица цифр (NULL - вход из байтов)
+    uint32_t src_radix;             // основание входа: 256 или radix
+    uint32_t dst_base;              // основание слов результата (BIGNUM_BINARY для 2^32)
+    size_t bound_num;               // слов на 100 символов входа (с запасом)
+    uint32_t* pow[RADIX_DC_LEVELS]; // pow[k] = src_radix^(RADIX_DC_LEAF * 2^k)
+    size_t pow_len[RADIX_DC_LEVELS];
+    thread_pool* pool;              // пул потоков (NULL - перевод в вызывающем потоке)
+} radix_dc;
+
+
+
+// Функция перевода листа рекурсии
+static uint32_t* dc_leaf(const radix_dc* dc, const unsigned char* input, size_t len, size_t* count) {
+    uint32_t* limbs = (uint32_t*)malloc((len * dc->bound_num / 100 + 2) * sizeof(uint32_t));
+    if (!limbs) {
+        return NULL;
+    }
+    if (dc->rev_table) {
+        *count = chars_to_limbs_any(input, len, dc->rev_table, dc->src_radix, limbs);
+    } else {
+        *count = bytes_to_limbs_any(input, len, limbs, dc->dst_base);
+    }
+    return limbs;
+}
+
+
+
+// Функция сборки узла рекурсии из двух половин
+static uint32_t* dc_combine(const radix_dc* dc, uint32_t* high, size_t high_count, uint32_t* low, size_t low_count,
+                            int level, thread_pool* pool, size_t* count) {
+/**
+ * @brief result = high * src_radix^(RADIX_DC_LEAF * 2^(level - 1)) + low
+ *
+ * @param pool Пул для умножения (NULL - в вызывающем потоке)
+ * @return uint32_t* Нормализованное число или NULL при ошибке памяти; high и low освобождаются
+ */
+    // low < pow, поэтому сложение не выходит за high_count + pow_len + 1
+    size_t pow_len = dc->pow_len[level - 1];
+    size_t result_count = high_count + pow_len;
+    uint32_t* result = (uint32_t*)malloc((result_count + 1) * sizeof(uint32_t));
+    if (result && bignum_mul_parallel(result, high, high_count, dc->pow[level - 1], pow_len, dc->dst_base, pool) == 0) {
+        result_count = bignum_add(result, result_count, low, low_count, dc->dst_base);
+        *count = bignum_normalize(result, result_count);
+    } else {
+        free(result);
+        result = NULL;
+    }
+
+    free(high);
+    free(low);
+    return result;
+}
+
+
+
+// Функция рекурсивного перевода
+static uint32_t* dc_convert(const radix_dc* dc, const unsigned char* input, size_t len, int level, size_t* count) {
+/**
+ * @brief Переводит вход длины len <= RADIX_DC_LEAF * 2^level
+ *
+ * @return uint32_t* Нормализованное число (освобождает вызывающий) или NULL при ошибке памяти
+ *
+ * @note Младшая часть всегда имеет длину RADIX_DC_LEAF * 2^(level - 1), поэтому множитель
+ *       берётся из заранее вычисленной таблицы степеней
+ */
+    while (level > 0 && len <= ((size_t)RADIX_DC_LEAF << (level - 1))) {
+        level--;
+    }
+    if (level == 0) {
+        return dc_leaf(dc, input, len, count);
+    }
+
+    size_t m = (size_t)RADIX_DC_LEAF << (level - 1);
+    size_t high_count, low_count;
+    uint32_t* high = dc_convert(dc, input, len - m, level - 1, &high_count);
+    if (!high) {
+        return NULL;
+    }
+    uint32_t* low = dc_convert(dc, input + len - m, m, level - 1, &low_count);
+    if (!low) {
+        free(high);
+        return NULL;
+    }
+    return dc_combine(dc, high, high_count, low, low_count, level, NULL, count);
+}
+
+
+
+// Узлы одного уровня параллельного перевода (узел 0 - младшая часть числа)
+typedef struct {
+    const radix_dc* dc;
+    const unsigned char* input;
+    size_t len;
+    size_t span;       // символов входа на узел уровня
+    int level;         // уровень узлов
+    uint32_t** nodes;  // числа узлов уровня
+    size_t* counts;
+    uint32_t** upper;  // узлы уровня выше: upper[k] собирается из nodes[2k + 1] и nodes[2k]
+    size_t* upper_counts;
+} dc_parallel_ctx;
+
+
+
+// Функция перевода одного поддерева
+static void dc_subtree_task(void* arg, size_t index) {
+/**
+ * @brief Переводит часть входа, которой соответствует узел index нижнего уровня
+ *
+ * @note Узлы отсчитываются с конца входа: все части, кроме старшей, имеют длину span
+ */
+    const dc_parallel_ctx* ctx = (const dc_parallel_ctx*)arg;
+    size_t end = ctx->len - index * ctx->span;
+    size_t start = end > ctx->span ? end - ctx->span : 0;
+    ctx->nodes[index] = dc_convert(ctx->dc, ctx->input + start, end - start, ctx->level, &ctx->counts[index]);
+}
+
+
+
+// Функция сборки одного узла из пары узлов нижнего уровня
+static void dc_combine_task(void* arg, size_t index) {
+    const dc_parallel_ctx* ctx = (const dc_parallel_ctx*)arg;
+    uint32_t* high = ctx->nodes[2 * index + 1];
+    uint32_t* low = ctx->nodes[2 * index];
+    ctx->nodes[2 * index] = NULL;
+    ctx->nodes[2 * index + 1] = NULL;
+    ctx->upper[index] = dc_combine(ctx->dc, high, ctx->counts[2 * index + 1], low, ctx->counts[2 * index],
+                                   ctx->level, NULL, &ctx->upper_counts[index]);
+}
+
+
+
+// Функция параллельного перевода методом "разделяй и властвуй"
+static uint32_t* dc_convert_parallel(const radix_dc* dc, const unsigned char* input, size_t len, int levels,
+                                     size_t* count) {
+/**
+ * @brief Переводит вход на пуле dc->pool, результат тот же, что у dc_convert
+ *
+ * @return uint32_t* Нормализованное число (освобождает вызывающий) или NULL при ошибке памяти
+ *
+ * @note Вход делится на поддеревья уровня split (не меньше RADIX_DC_TASKS_PER_THREAD на поток),
+ *       которые переводятся параллельно. Затем уровни собираются снизу вверх: пока узлов
+ *       не меньше, чем потоков, каждый узел - отдельная задача, а на верхних уровнях узлы
+ *       собираются по очереди и между потоками делится само умножение
+ */
+    size_t threads = (size_t)thread_pool_size(dc->pool);
+    int split = levels;
+    while (split > 0 && (len - 1) / ((size_t)RADIX_DC_LEAF << split) + 1 < threads * RADIX_DC_TASKS_PER_THREAD) {
+        split--;
+    }
+
+    size_t span = (size_t)RADIX_DC_LEAF << split;
+    size_t nodes_count = (len - 1) / span + 1;
+    uint32_t** nodes = (uint32_t**)calloc(2 * nodes_count, sizeof(uint32_t*));
+    size_t* counts = (size_t*)malloc(2 * nodes_count * sizeof(size_t));
+    if (!nodes || !counts) {
+        free(nodes);
+        free(counts);
+        return NULL;
+    }
+
+    dc_parallel_ctx ctx = {dc, input, len, span, split, nodes, counts, nodes + nodes_count, counts + nodes_count};
+    thread_pool_run(dc->pool, nodes_count, dc_subtree_task, &ctx);
+
+    int failed = 0;
+    for (size_t k = 0; k < nodes_count; k++) {
+        failed |= (ctx.nodes[k] == NULL);
+    }
+
+    // Уровень level собирается из пар узлов уровня level - 1; узел без старшей пары переходит выше как есть
+    for (ctx.level = split + 1; !failed && nodes_count > 1; ctx.level++) {
+        size_t pairs = nodes_count / 2;
+        if (pairs >= threads) {
+            thread_pool_run(dc->pool, pairs, dc_combine_task, &ctx);
+        } else {
+            for (size_t k = 0; k < pairs; k++) {
+                ctx.upper[k] = dc_combine(dc, ctx.nodes[2 * k + 1], ctx.counts[2 * k + 1], ctx.nodes[2 * k],
+                                          ctx.counts[2 * k], ctx.level, dc->pool, &ctx.upper_counts[k]);
+                ctx.nodes[2 * k] = ctx.nodes[2 * k + 1] = NULL;
+            }
+        }
+        if (nodes_count % 2) {
+            ctx.upper[pairs] = ctx.nodes[nodes_count - 1];
+            ctx.upper_counts[pairs] = ctx.counts[nodes_count - 1];
+            ctx.nodes[nodes_count - 1] = NULL;
+        }
+        nodes_count = (nodes_count + 1) / 2;
+
+        uint32_t** swap_nodes = ctx.nodes;
+        size_t* swap_counts = ctx.counts;
+        ctx.nodes = ctx.upper;
+        ctx.counts = ctx.upper_counts;
+        ctx.upper = swap_nodes;
+        ctx.upper_counts = swap_counts;
+        for (size_t k = 0; k < nodes_count; k++) {
+            failed |= (ctx.nodes[k] == NULL);
+        }
+    }
+
+    uint32_t* result = NULL;
+    if (!failed) {
+        result = ctx.nodes[0];
+        *count = ctx.counts[0];
+        ctx.nodes[0] = NULL;
+    }
+    for (size_t k = 0; k < nodes_count; k++) {
+        free(ctx.nodes[k]);
+    }
+    free(nodes);
+    free(counts);
+    return result;
+}
+
+
+
+// Функция перевода длинного входа методом "разделяй и властвуй"
+static size_t dc_run(radix_dc* dc, const unsigned char* input, size_t len, uint32_t* limbs) {
+/**
+ * @brief Строит таблицу степеней, выполняет рекурсию и копирует результат в limbs
+ *
+ * @return size_t Количество слов или RADIX_ERROR при ошибке выделения памяти
+ */
+    uint64_t word = (dc->dst_base == BIGNUM_BINARY) ? ((uint64_t)1 << 32) : dc->dst_base;
+    size_t result = RADIX_ERROR;
+    int levels = 0;
+    while ((size_t)RADIX_DC_LEAF << levels < len) {
+        levels++;
+    }
+
+    // pow[0] = src_radix^RADIX_DC_LEAF умножениями на src_radix
+    memset(dc->pow, 0, sizeof(dc->pow));
+    dc->pow[0] = (uint32_t*)malloc((RADIX_DC_LEAF * dc->bound_num / 100 + 2) * sizeof(uint32_t));
+    if (!dc->pow[0]) {
+        return RADIX_ERROR;
+    }
+    dc->pow[0][0] = 1;
+    dc->pow_len[0] = 1;
+    for (int i = 0; i < RADIX_DC_LEAF; i++) {
+        dc->pow_len[0] = limbs_mul_add(dc->pow[0], dc->pow_len[0], dc->src_radix, 0, word);
+    }
+
+    // pow[k] = pow[k - 1]^2; наибольшая нужная степень - pow[levels - 1]
+    for (int k = 1; k < levels; k++) {
+        size_t n = dc->pow_len[k - 1];
+        dc->pow[k] = (uint32_t*)malloc(2 * n * sizeof(uint32_t));
+        if (!dc->pow[k] ||
+            bignum_mul_parallel(dc->pow[k], dc->pow[k - 1], n, dc->pow[k - 1], n, dc->dst_base, dc->pool) != 0) {
+            goto cleanup;
+        }
+        dc->pow_len[k] = bignum_normalize(dc->pow[k], 2 * n);
+    }
+
+    size_t count;
+    uint32_t* value = thread_pool_size(dc->pool) > 1 ? dc_convert_parallel(dc, input, len, levels, &count)
+                                                     : dc_convert(dc, input, len, levels, &count);
+    if (value) {
+        memcpy(limbs, value, count * sizeof(uint32_t));
+        free(value);
+        result = count;
+    }
+
+cleanup:
+    for (int k = 0; k < RADIX_DC_LEVELS; k++) {
+        free(dc->pow[k]);
+    }
+    return result;
+}
+
+
+
+// Функция перевода байтов (big-endian число) в слова по основанию limb_base
+size_t radix_from_bytes(const unsigned char* input, size_t len, uint32_t* limbs, uint32_t limb_base) {
+/**
+ * @brief Переводит байтовую строку в число из слов по основанию limb_base
+ * 
+ * @param input Входные байты (старший байт первый)
+ * @param len Количество байтов
+ * @param limbs Буфер слов (не меньше len * 28 / 100 + 2 для оснований 58^5 и 62^5)
+ * @param limb_base Основание слова
+ * @return size_t Количество значащих слов (0 для нулевого числа) или RADIX_ERROR
+ * 
+ * @note Начиная с RADIX_DC_BYTES_THRESHOLD байтов используется рекурсивный перевод
+ */
+    return radix_from_bytes_parallel(input, len, limbs, limb_base, NULL);
+}
+
+
+
+// Функция перевода байтов в слова на пуле потоков
+size_t radix_from_bytes_parallel(const unsigned char* input, size_t len, uint32_t* limbs, uint32_t limb_base,
+                                 thread_pool* pool) {
+/**
+ * @brief radix_from_bytes, рекурсивный перевод которого выполняется на пуле потоков
+ * 
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество значащих слов (0 для нулевого числа) или RADIX_ERROR
+ */
+    if (len < RADIX_DC_BYTES_THRESHOLD) {
+        return bytes_to_limbs_any(input, len, limbs, limb_base);
+    }
+    radix_dc dc = {.rev_table = NULL, .src_radix = 256, .dst_base = limb_base, .bound_num = 28, .pool = pool};
+    return dc_run(&dc, input, len, limbs);
+}
+
+
+
+// Функция перевода символов алфавита (по основанию radix) в 32-битные слова
+size_t radix_from_chars(const unsigned char* input, size_t len, const unsigned char* rev_table, uint32_t radix, uint32_t* limbs) {
+/**
+ * @brief Переводит строку цифр (старшая цифра первой) в двоичное число из 32-битных слов
+ * 
+ * @param input Символы алфавита (должны быть заранее проверены по rev_table)
+ * @param len Количество символов
+ * @param rev_table Обратная таблица алфавита
+ * @param radix Основание системы счисления (58 или 62)
+ * @param limbs Буфер слов (не меньше len * 19 / 100 + 2)
+ * @return size_t Количество значащих слов (0 для нулевого числа) или RADIX_ERROR
+ * 
+ * @note Начиная с RADIX_DC_CHARS_THRESHOLD символов используется рекурсивный перевод
+ */
+    return radix_from_chars_parallel(input, len, rev_table, radix, limbs, NULL);
+}
+
+
+
+// Функция перевода символов алфавита в 32-битные слова на пуле потоков
+size_t radix_from_chars_parallel(const unsigned char* input, size_t len, const unsigned char* rev_table, uint32_t radix,
+                                 uint32_t* limbs, thread_pool* pool) {
+/**
+ * @brief radix_from_chars, рекурсивный перевод которого выполняется на пуле потоков
+ * 
+ * @param pool Пул потоков (NULL - в вызывающем потоке)
+ * @return size_t Количество значащих слов (0 для нулевого числа) или RADIX_ERROR
+ */
+    if (len < RADIX_DC_CHARS_THRESHOLD) {
+        return chars_to_limbs_any(input, len, rev_table, radix, limbs);
+    }
+    radix_dc dc = {.rev_table = rev_table, .src_radix = radix, .dst_base = BIGNUM_BINARY, .bound_num = 19, .pool = pool};
+    return dc_run(&dc, input, len, limbs);
+}
+
+
+
+// Функция ширины группы цифр для блока из len байтов
+size_t radix_block_width(size_t len, uint32_t radix) {
+/**
+ * @brief Возвращает наименьшее w, при котором radix^w >= 256^len
+ * 
+ * @note Считается точно: число 256^len - 1 делится на radix, пока не станет нулём
+ */
+    unsigned char value[RADIX_BLOCK_BYTES];
+    size_t width = 0;
+    size_t start = 0;
+    memset(value, 0xFF, len);
+    while (start < len) {
+        uint32_t rem = 0;
+        for (size_t i = start; i < len; i++) {
+            uint32_t cur = (rem << 8) | value[i];
+            value[i] = (unsigned char)(cur / radix);
+            rem = cur % radix;
+        }
+        while (start < len && value[start] == 0) {
+            start++;
+        }
+        width++;
+    }
+    return width;
+}
+
+
+
+// Функция перевода блока байтов в группу цифр фиксированной ширины
+void radix_block_to_chars(const unsigned char* block, size_t len, uint32_t radix, const char* table, char* output, size_t width) {
+/**
+ * @brief Записывает блок (не длиннее RADIX_BLOCK_BYTES) ровно width цифрами, старшая первой
+ * 
+ * @param width Ширина группы (radix_block_width(len, radix))
+ * 
+ * @note Недостающие старшие цифры дополняются нулевым символом алфавита
+ */
+    uint32_t limbs[RADIX_BLOCK_BYTES * 28 / 100 + 2];
+    uint32_t limb_base = radix * radix * radix * radix * radix;
+    size_t count = bytes_to_limbs_any(block, len, limbs, limb_base);
+
+    size_t pos = width;
+    for (size_t k = 0; k < count; k++) {
+        uint32_t value = limbs[k];
+        for (int d = 0; d < RADIX_LIMB_DIGITS && pos > 0; d++) {
+            output[--pos] = table[value % radix];
+            value /= radix;
+        }
+    }
+    while (pos > 0) {
+        output[--pos] = table[0];
+    }
+}
+
+
+
+// Функция перевода группы цифр фиксированной ширины в блок байтов
+int radix_block_from_chars(const unsigned char* input, size_t width, const unsigned char* rev_table, uint32_t radix, unsigned char* output, size_t len) {
+/**
+ * @brief Восстанавливает блок из len байтов по группе из width цифр
+ * 
+ * @param input Символы группы (должны быть заранее проверены по rev_table)
+ * @return int 0 при успехе, -1 если значение группы не помещается в len байтов
+ */
+    uint32_t limbs[RADIX_BLOCK_BYTES * 19 / 100 + 8];
+    size_t count = chars_to_limbs_any(input, width, rev_table, radix, limbs);
+
+    unsigned char bytes[sizeof(limbs)];
+    size_t bytes_len = radix_limbs_to_bytes(limbs, count, bytes);
+    if (bytes_len > len) {
+        return -1;
+    }
+    memset(output, 0, len - bytes_len);
+    memcpy(output + len - bytes_len, bytes, bytes_len);
+    return 0;
+}
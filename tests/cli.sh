@@ -0,0 +1,135 @@
+#!/bin/bash
+
+# Проверки командной строки:
+#  - декодирование некорректного входа завершается ненулевым кодом и не оставляет выходной файл;
+#  - кодирование и декодирование каждым алгоритмом на каждом уровне --cpu с -j 1 и -j 4
+#    возвращает исходные данные, а закодированный текст совпадает со скалярным;
+#  - большие входы проходят через параллельное декодирование.
+# Запуск из корня проекта после сборки (c.sh): bash tests/cli.sh [путь к программе]
+
+PROGRAM=$(realpath "${1:-output/main}")
+if [ ! -x "$PROGRAM" ]; then
+    echo "Программа не найдена: $PROGRAM"
+    exit 1
+fi
+
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+ALGORITHMS="base16 base32 base58 base62 base64 base85 base58b base62b ascii85"
+
+# Уровни, недоступные процессору, урезаются до доступных, поэтому перечисляются все
+TIERS="scalar sse2 ssse3 avx2 avx512 neon"
+
+# Размеры вокруг ширины векторных ядер (16, 32, 48, 64 байта входа) и блоков Base58/62b (32)
+SIZES="0 1 2 3 4 5 7 8 15 16 17 31 32 33 47 48 49 63 64 65 95 96 97 127 128 129 191 192 193 255 256 257 1000 4099"
+
+failed=0
+
+# Функция сообщения об ошибке проверки
+fail() {
+    echo "FAIL: $*"
+    failed=1
+}
+
+# Функция получения случайных данных размера $1 в файл $2
+# (Base58/Base62 не сохраняют ведущие нулевые байты, поэтому первый байт не нулевой)
+random_data() {
+    if [ "$1" -eq 0 ]; then
+        : > "$2"
+    else
+        { printf '\001'; head -c $(($1 - 1)) /dev/urandom; } > "$2"
+    fi
+}
+
+# Функция сравнения результата декодирования с исходными данными
+# (Base85 дополняет результат нулями до кратного 4 размера)
+same_data() {
+    local algorithm=$1 original=$2 decoded=$3
+    local size decoded_size
+    size=$(stat -c %s "$original")
+    decoded_size=$(stat -c %s "$decoded")
+    if [ "$algorithm" = "base85" ]; then
+        [ "$decoded_size" -ge "$size" ] && [ "$decoded_size" -le $((size + 3)) ] && cmp -s -n "$size" "$original" "$decoded"
+    else
+        cmp -s "$original" "$decoded"
+    fi
+}
+
+
+# Некорректный вход
+for algorithm in $ALGORITHMS; do
+    # Управляющие символы не входят ни в один алфавит и не считаются пробелами
+    printf 'AB\001\002CD' > "$WORK/bad.$algorithm"
+    "$PROGRAM" decode -a "$algorithm" -i "$WORK/bad.$algorithm" -o "$WORK/bad.out" 2> /dev/null
+    status=$?
+    if [ $status -eq 0 ] || [ -e "$WORK/bad.out" ]; then
+        fail "$algorithm: некорректный вход (код $status, выходной файл $( [ -e "$WORK/bad.out" ] && echo создан || echo отсутствует ))"
+    fi
+    rm -f "$WORK/bad.out"
+done
+
+
+# Кодирование и декодирование на всех уровнях --cpu
+for size in $SIZES; do
+    random_data "$size" "$WORK/in.bin"
+    for algorithm in $ALGORITHMS; do
+        if ! "$PROGRAM" --cpu=scalar -j 1 encode -a "$algorithm" -i "$WORK/in.bin" -o "$WORK/ref.txt"; then
+            fail "$algorithm n=$size: скалярное кодирование"
+            continue
+        fi
+        for tier in $TIERS; do
+            for threads in 1 4; do
+                run="$algorithm n=$size --cpu=$tier -j $threads"
+                "$PROGRAM" --cpu="$tier" -j "$threads" encode -a "$algorithm" -i "$WORK/in.bin" -o "$WORK/enc.txt" ||
+                    { fail "$run: кодирование"; continue; }
+                cmp -s "$WORK/ref.txt" "$WORK/enc.txt" || fail "$run: текст отличается от скалярного"
+                "$PROGRAM" --cpu="$tier" -j "$threads" decode -a "$algorithm" -i "$WORK/enc.txt" -o "$WORK/dec.bin" 2> /dev/null ||
+                    { fail "$run: декодирование"; continue; }
+                same_data "$algorithm" "$WORK/in.bin" "$WORK/dec.bin" || fail "$run: данные не совпали"
+            done
+        done
+    done
+done
+
+
+# Большие входы: закодированный текст больше порога параллельного декодирования
+# (8 МиБ для Base16/32/64/85, 256 КиБ для Base58/62)
+random_data $((8 << 20)) "$WORK/big.bin"
+random_data $((300 << 10)) "$WORK/radix.bin"
+for algorithm in base16 base32 base64 base85 base58 base62; do
+    case $algorithm in
+        base58|base62) input="$WORK/radix.bin" ;;
+        *) input="$WORK/big.bin" ;;
+    esac
+    "$PROGRAM" --cpu=scalar encode -a "$algorithm" -i "$input" -o "$WORK/ref.txt" || { fail "$algorithm: большое кодирование"; continue; }
+    for tier in scalar avx512; do
+        for threads in 1 4; do
+            run="$algorithm (большой) --cpu=$tier -j $threads"
+            "$PROGRAM" --cpu="$tier" -j "$threads" encode -a "$algorithm" -i "$input" -o "$WORK/enc.txt" ||
+                { fail "$run: кодирование"; continue; }
+            cmp -s "$WORK/ref.txt" "$WORK/enc.txt" || fail "$run: текст отличается от скалярного"
+            "$PROGRAM" --cpu="$tier" -j "$threads" decode -a "$algorithm" -i "$WORK/enc.txt" -o "$WORK/dec.bin" 2> /dev/null ||
+                { fail "$run: декодирование"; continue; }
+            same_data "$algorithm" "$input" "$WORK/dec.bin" || fail "$run: данные не совпали"
+        done
+    done
+done
+
+# Ошибка в большом входе сообщается с позицией первого недопустимого символа
+rm -f "$WORK/dec.bin"
+"$PROGRAM" encode -a base64 -i "$WORK/big.bin" -o "$WORK/big.txt"
+printf '!' | dd of="$WORK/big.txt" bs=1 seek=5000000 conv=notrunc status=none
+printf '!' | dd of="$WORK/big.txt" bs=1 seek=1000 conv=notrunc status=none
+for threads in 1 4; do
+    message=$("$PROGRAM" -j "$threads" decode -a base64 -i "$WORK/big.txt" -o "$WORK/dec.bin" 2>&1 > /dev/null)
+    echo "$message" | grep -q "failed at offset 1000$" || fail "base64 (большой) -j $threads: нет позиции ошибки: $message"
+    [ -e "$WORK/dec.bin" ] && fail "base64 (большой) -j $threads: создан выходной файл при ошибке"
+    rm -f "$WORK/dec.bin"
+done
+
+
+if [ $failed -ne 0 ]; then
+    exit 1
+fi
+echo "Все проверки пройдены"